@@ -0,0 +1,102 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file Coloring.h
+ * 
+ * @brief This is a header file for the implementation of the coloring algorithm for finding strongly 
+ * connected components (SCCs) in a directed graph. The algorithm is parallelized with OpenMP: the colors 
+ * are propagated forward by a level-synchronous breadth-first search whose frontiers are expanded by all 
+ * the threads, and the backward searches of the different colors run in parallel.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#ifndef COLORING_H
+#define COLORING_H
+
+#include <stdbool.h>
+
+#include "TGraph.h"
+#include "TArray.h"
+#include "Utils.h"
+#include "Trim.h"
+
+/**
+ * @brief Color of the vertices whose SCC has been found. The other vertices are colored with the position 
+ * of a vertex, which is never negative.
+ */
+#define COLORING_DONE -1
+
+/**
+ * @brief Frontiers of the forward propagation with more than this number of vertices are expanded in 
+ * parallel.
+ */
+#ifndef COLORING_FRONTIER_CUTOFF
+#define COLORING_FRONTIER_CUTOFF 1024
+#endif
+
+/**
+ * @brief This function propagates forward the maximum color along the edges of a graph, within the vertices 
+ * of a cut that are still active, until a fixpoint is reached.
+ */
+void coloringPropagate(TGraph, int*, int*, int*, int*, int, int, int, int*);
+
+/**
+ * @brief This function collects with a backward breadth-first search the vertices with the color of a root 
+ * that reach it, which form the SCC of the root, and records the SCC.
+ */
+void coloringCollect(TGraph, TGraph, int*, int, int**, int*, int, int, TSCCs*);
+
+/**
+ * @brief This function performs a round of the coloring algorithm on the active vertices of a cut, recording 
+ * the SCCs found. It returns the number of vertices still active.
+ */
+int coloringStep(TGraph, TGraph, int*, int*, int*, int*, int*, int, int, int, int*, TSCCs*);
+
+/**
+ * @brief This function performs the coloring algorithm for finding strongly connected components (SCCs) 
+ * in a directed graph. The function returns the set of the SCCs.
+ */
+TSCCs coloring(TGraph, int, int);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,220 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file Communication.h
+ * 
+ * @brief This is a header file for the transfers of the merge rounds. A buffer is sent as a stream of 
+ * nonblocking messages of at most COMM_CHUNK_SIZE integers, the last of which is shorter than a chunk, 
+ * so that the receiver does not need a separate message with the size, and can work on the streams 
+ * already complete while the chunks of the other ones are still arriving. The processes on the same node 
+ * exchange the same payloads through a shared memory window instead.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#ifndef COMMUNICATION_H
+#define COMMUNICATION_H
+
+#include <stdbool.h>
+#include <mpi.h>
+
+#include "TGraph.h"
+
+/**
+ * @brief The number of integers of a chunk of the transfers of the merge rounds.
+ */
+#ifndef COMM_CHUNK_SIZE
+#define COMM_CHUNK_SIZE 65536
+#endif
+
+/**
+ * @brief The number of integers above which a buffer is sent in the compressed encoding of Compression.h, 
+ * if the encoding makes it smaller. Below this size the time to encode a buffer is not repaid by the bytes 
+ * saved on the network.
+ */
+#ifndef COMM_COMPRESSION_THRESHOLD
+#define COMM_COMPRESSION_THRESHOLD 16384
+#endif
+
+/**
+ * @brief If not 0, the processes of a merge group running on the same node exchange their payloads through 
+ * a shared memory window instead of messages.
+ */
+#ifndef COMM_SHARED_MEMORY
+#define COMM_SHARED_MEMORY 1
+#endif
+
+/**
+ * @brief The number of integers of the header of a shared segment: the number of vertices, ghosts and 
+ * edges of the graph and the sizes of the two serialized hash tables.
+ */
+#define COMM_SHARED_HEADER 5
+
+/**
+ * @brief The tags of the streams sent by every process of a group to the first one in a merge round: the 
+ * header of its condensed graph, the ids, offsets and targets arrays of the graph, its hash table of the 
+ * macronodes and its hash table of the auxiliary graph.
+ */
+#define COMM_TAG_GRAPH 0
+#define COMM_TAG_GRAPH_IDS 1
+#define COMM_TAG_GRAPH_OFFSETS 2
+#define COMM_TAG_GRAPH_TARGETS 3
+#define COMM_TAG_SCCS_HT 4
+#define COMM_TAG_AUXILIARY_GRAPH_HT 5
+#define COMM_STREAMS 6
+
+/**
+ * @brief The pending sends of a process: the requests of all the chunks posted and not yet completed, the 
+ * header of the graph being sent and the buffers owned by the sends, which have to live until the sends are 
+ * complete.
+ */
+typedef struct {
+    MPI_Request* requests;
+    int count;
+    int capacity;
+    int header[4];
+    int* owned[COMM_STREAMS];
+    int ownedCount;
+} TChunkedSend;
+
+/**
+ * @brief A stream being received: the buffer, grown as the chunks arrive unless its size is known in 
+ * advance, the number of integers received so far, the array where the stream is decompressed if it is 
+ * not a new one, and the source and the tag the stream comes from.
+ */
+typedef struct {
+    int* buffer;
+    int size;
+    int capacity;
+    bool fixed;
+    int* target;
+    int source;
+    int tag;
+    MPI_Comm comm;
+} TChunkedRecv;
+
+/**
+ * @brief The shared memory of a merge round: the communicator of the processes on the same node, the rank 
+ * in it of every process of the round communicator (MPI_UNDEFINED for the ones on other nodes), and the 
+ * window where every process of the node publishes its segment.
+ */
+typedef struct {
+    MPI_Comm node;
+    int* nodeRanks;
+    MPI_Win window;
+    int* segment;
+} TSharedSegment;
+
+/**
+ * @brief This function creates an empty set of pending sends.
+ */
+TChunkedSend chunkedSendCreate();
+
+/**
+ * @brief This function posts the nonblocking sends of all the chunks of a buffer.
+ */
+void chunkedSend(TChunkedSend*, int*, int, int, int, MPI_Comm);
+
+/**
+ * @brief This function posts the nonblocking sends of a serialized buffer, compressed if it is large, and 
+ * takes the ownership of the buffer.
+ */
+void chunkedSendPayload(TChunkedSend*, int*, int, int, int, MPI_Comm);
+
+/**
+ * @brief This function posts the nonblocking sends of a graph: a header with its sizes followed by its CSR 
+ * arrays, sent directly from their storage unless they are compressed.
+ */
+void chunkedSendGraph(TChunkedSend*, TGraph, int, MPI_Comm);
+
+/**
+ * @brief This function waits for all the pending sends, after which their buffers can be freed.
+ */
+void chunkedSendWait(TChunkedSend*);
+
+/**
+ * @brief This function posts the receive of the first chunk of a stream.
+ */
+void chunkedRecvStart(TChunkedRecv*, MPI_Request*, int, int, MPI_Comm);
+
+/**
+ * @brief This function creates a graph from the header received from a process and posts the receives of 
+ * its CSR arrays directly into the arrays of the graph.
+ */
+TGraph chunkedRecvGraph(TChunkedRecv*, MPI_Request*);
+
+/**
+ * @brief This function waits until one of the streams is complete and returns its index, or MPI_UNDEFINED 
+ * when all of them have been returned.
+ */
+int chunkedRecvWaitAny(TChunkedRecv*, MPI_Request*, int);
+
+/**
+ * @brief This function groups the processes of a communicator by node.
+ */
+TSharedSegment sharedSegmentCreate(MPI_Comm);
+
+/**
+ * @brief This function checks if a process of the round communicator runs on the same node.
+ */
+bool sharedSegmentIsLocal(TSharedSegment*, int);
+
+/**
+ * @brief This function allocates the segment of every process of the node and copies into it the graph and 
+ * the two serialized hash tables of the process, if any.
+ */
+void sharedSegmentPublish(TSharedSegment*, TGraph, int*, int, int*, int);
+
+/**
+ * @brief This function returns the graph published by a process of the same node, whose arrays point into 
+ * its segment, together with its two serialized hash tables.
+ */
+TGraph sharedSegmentGraph(TSharedSegment*, int, int**, int**);
+
+/**
+ * @brief This function frees the window and the node communicator, after which the graphs returned by 
+ * sharedSegmentGraph() are no longer valid.
+ */
+void sharedSegmentDestroy(TSharedSegment*);
+
+#endif
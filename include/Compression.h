@@ -0,0 +1,94 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file Compression.h
+ * 
+ * @brief This is a header file for the compressed encoding of the arrays of integers exchanged by the 
+ * MPI processes. The arrays are mostly sorted or nearly sorted vertex ids, so every value is stored as the 
+ * difference from the previous one, mapped to an unsigned value with the zigzag encoding and written as a 
+ * variable-length integer of 7 bits per byte: small differences take a single byte instead of four.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#ifndef COMPRESSION_H
+#define COMPRESSION_H
+
+#include <stdbool.h>
+
+/**
+ * @brief The first integer of a compressed buffer. The serialized buffers always start with a count, which 
+ * is never negative, so a compressed buffer can be told apart from a plain one by its first integer.
+ */
+#define COMPRESSION_MARKER -1
+
+/**
+ * @brief The number of values of a block of a compressed buffer. The blocks are encoded and decoded 
+ * independently by the OpenMP threads, since the differences restart from 0 at the beginning of a block.
+ */
+#ifndef COMPRESSION_BLOCK
+#define COMPRESSION_BLOCK 4096
+#endif
+
+/**
+ * @brief This function compresses an array of integers, returning NULL when the compressed buffer would 
+ * not be smaller than the array.
+ */
+int* compressInts(const int*, int, int*);
+
+/**
+ * @brief This function returns the number of values stored in a compressed buffer.
+ */
+int compressedLength(const int*);
+
+/**
+ * @brief This function decompresses a compressed buffer into an array large enough for its values.
+ */
+void decompressInts(const int*, int*);
+
+/**
+ * @brief This function checks if a buffer of the given size is a compressed buffer.
+ */
+bool isCompressed(const int*, int);
+
+#endif
@@ -57,17 +57,18 @@
 
 #include "TGraph.h"
 #include "THTSCCs.h"
+#include "TSCCs.h"
 
 /**
  * @brief Prints the Strongly Connected Components found in the current
  * iteration of the algorithm.
  */ 
-void printSCCs(int, TArray*, int, THTSCCs*);
+void printSCCs(TSCCs*, int, THTSCCs*);
 
 /**
  * @brief Writes the strongly connected components (SCCs) to a file.
 */
-void printSCCsOnFile(int, TArray*, int, THTSCCs*, char*);
+void printSCCsOnFile(TSCCs*, int, THTSCCs*, char*);
 
 /**
  * @brief Recursively prints the nodes belonging to a macro-node.
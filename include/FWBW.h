@@ -0,0 +1,118 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file FWBW.h
+ * 
+ * @brief This is a header file for the implementation of the Forward-Backward (FW-BW) algorithm for 
+ * finding strongly connected components (SCCs) in a directed graph. The algorithm is parallelized 
+ * with OpenMP tasks: every subproblem is solved by a task and the reachable sets are computed with a 
+ * level-synchronous breadth-first search whose large frontiers are expanded by a taskloop.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#ifndef FWBW_H
+#define FWBW_H
+
+#include <stdbool.h>
+
+#include "TGraph.h"
+#include "TArray.h"
+#include "Utils.h"
+#include "Trim.h"
+
+/**
+ * @brief Color of the vertices whose SCC has been found. The colors of the subproblems start from 1.
+ */
+#define FWBW_DONE 0
+
+/**
+ * @brief Subproblems with at most this number of vertices are solved by the task that creates them, 
+ * instead of being deferred to a new task.
+ */
+#ifndef FWBW_TASK_CUTOFF
+#define FWBW_TASK_CUTOFF 256
+#endif
+
+/**
+ * @brief Frontiers of the breadth-first search with more than this number of vertices are expanded 
+ * in parallel by a taskloop.
+ */
+#ifndef FWBW_FRONTIER_CUTOFF
+#define FWBW_FRONTIER_CUTOFF 1024
+#endif
+
+/**
+ * @brief A structure holding the state shared by all the tasks of the FW-BW algorithm: the graph and its 
+ * transpose restricted to the cut, the bounds of the cut, the color of every vertex of the cut, the next 
+ * color to be assigned and the SCCs found.
+ */
+typedef struct {
+    TGraph graph;
+    TGraph transpose;
+    int start;
+    int stop;
+    int *color;
+    int nextColor;
+    TSCCs sccs;
+} TFWBWContext;
+
+/**
+ * @brief This function computes the set of vertices reachable from a pivot in a graph, within the vertices 
+ * of a given color, recoloring them. It returns the number of vertices reached.
+ */
+int fwbwReach(TFWBWContext*, TGraph, int*, int, int, int, int, int);
+
+/**
+ * @brief This function solves a subproblem of the FW-BW algorithm, given the list of its vertices and its 
+ * color, and spawns a task for every subproblem it creates.
+ */
+void fwbwSolve(TFWBWContext*, int*, int, int);
+
+/**
+ * @brief This function performs the Forward-Backward algorithm for finding strongly connected components (SCCs) 
+ * in a directed graph. The function returns the set of the SCCs.
+ */
+TSCCs fwbw(TGraph, int, int);
+
+#endif
\ No newline at end of file
@@ -56,11 +56,10 @@
 
 #include "TGraph.h"
 #include "TArray.h"
-#include "THTAuxiliarySCC.h"
 #include "Utils.h"
+#include "Trim.h"
 
 #define NOT_INITIALIZED -1
-#define DELTA 10
 
 /**
  * @brief This function creates the transpose of a given graph within a specified range of vertices.
@@ -68,23 +67,22 @@
 TGraph transposeGraph(TGraph*, int, int);
 
 /**
- * @brief This function performs a depth-first search (DFS) on a given node in a graph, within a specified 
- * range of vertices, and updates a stack with the visited nodes.
+ * @brief This function performs an iterative depth-first search (DFS) on a given node in a graph, within a 
+ * specified range of vertices, and appends the visited nodes to the finish order.
  */
-void dfs1(int, TGraph*, THTAuxiliarySCC*, TStack*, int, int);
+void dfs1(int, TGraph*, uint64_t*, TDFSFrame*, int*, int*, int, int);
 
 /**
- * @brief function "dfs2" performs a depth-first search (DFS) on a given graph and its transpose, using an 
- * auxiliary hash table and an array of strongly connected components (SCCs). The DFS starts at a given node 
- * and continues until it reaches a specified stop point. The function also updates a count of the number of 
- * SCCs and an array of the SCCs themselves.
+ * @brief function "dfs2" performs an iterative depth-first search (DFS) on the transpose of a graph, using a 
+ * bitset of visited vertices, a buffer of frames and a set of strongly connected components (SCCs). The DFS 
+ * starts at a given node and collects the vertices of its SCC, which is appended to the set of the SCCs.
  */
-void dfs2(int, TGraph*, THTAuxiliarySCC*, int, int, int *, TArray *);
+void dfs2(int, TGraph*, uint64_t*, TDFSFrame*, int*, int, int, TSCCs*);
 
 /**
  * @brief This function performs the Kosaraju's algorithm for finding strongly connected components (SCCs) in a 
- * directed graph. The function returns an array of SCCs.
+ * directed graph. The function returns the set of the SCCs.
  */
-TArray* kosaraju(TGraph , int , int , int *);
+TSCCs kosaraju(TGraph , int , int);
 
 #endif
\ No newline at end of file
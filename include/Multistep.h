@@ -0,0 +1,114 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file Multistep.h
+ * 
+ * @brief This is a header file for the implementation of the Multistep pipeline for finding strongly 
+ * connected components (SCCs) in a directed graph. The pipeline chains the other algorithms, each on 
+ * the part of the graph it handles best: the trimming pre-pass removes the trivial SCCs, a single 
+ * parallel FW-BW step finds the giant SCC, the coloring algorithm peels the medium SCCs and the 
+ * Tarjan algorithm finishes the small residual subgraph.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#ifndef MULTISTEP_H
+#define MULTISTEP_H
+
+#include <stdbool.h>
+
+#include "TGraph.h"
+#include "TArray.h"
+#include "Utils.h"
+#include "Trim.h"
+
+/**
+ * @brief The FW-BW step looking for the giant SCC runs only when more than this number of vertices are left 
+ * after the trimming pre-pass.
+ */
+#ifndef MULTISTEP_FWBW_CUTOFF
+#define MULTISTEP_FWBW_CUTOFF 1024
+#endif
+
+/**
+ * @brief The coloring rounds stop, leaving the residual subgraph to the Tarjan algorithm, when at most this 
+ * number of vertices are left.
+ */
+#ifndef MULTISTEP_TARJAN_CUTOFF
+#define MULTISTEP_TARJAN_CUTOFF 10000
+#endif
+
+/**
+ * @brief A structure holding the time, in seconds, spent in every phase of the Multistep pipeline, summed 
+ * over all the calls of the "multistep" function.
+ */
+typedef struct {
+    double trim;
+    double fwbw;
+    double coloring;
+    double tarjan;
+} TMultistepTimes;
+
+/**
+ * @brief The time spent in every phase by the calls of the "multistep" function of this process.
+ */
+extern TMultistepTimes multistepTimes;
+
+/**
+ * @brief This function finds the giant SCC of the active vertices of a cut, with a single FW-BW step from the 
+ * vertex with the highest product of in-degree and out-degree. It returns the number of vertices still active.
+ */
+int multistepGiant(TGraph, TGraph, int*, int*, int*, int, int, int, TSCCs*);
+
+/**
+ * @brief This function finds with the Tarjan algorithm the SCCs of the active vertices of a cut.
+ */
+void multistepTail(TGraph, int*, int*, int, int, int, TSCCs*);
+
+/**
+ * @brief This function performs the Multistep pipeline for finding strongly connected components (SCCs) 
+ * in a directed graph. The function returns the set of the SCCs.
+ */
+TSCCs multistep(TGraph, int, int);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,81 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file Partition.h
+ * 
+ * @brief This is a header file for the locality-aware partitioner of the graphs. The partitioner 
+ * computes, with a size-constrained label propagation, a permutation of the vertices that keeps the 
+ * densely connected regions of the graph together, so that when the permuted vertices are split in 
+ * contiguous partitions most of the strongly connected components (SCCs) fall inside a single one and 
+ * are found by the local pass of the MPI processes instead of by the merge rounds.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#ifndef PARTITION_H
+#define PARTITION_H
+
+#include "TGraph.h"
+
+/**
+ * @brief Maximum number of rounds of the label propagation. The propagation stops earlier when a round 
+ * does not move any vertex.
+ */
+#ifndef PARTITION_LP_ROUNDS
+#define PARTITION_LP_ROUNDS 20
+#endif
+
+/**
+ * @brief This function computes a permutation of the vertices of a graph which groups the vertices by 
+ * the cluster found by a label propagation, with clusters no larger than a partition. It returns the 
+ * positions of the vertices in the order of the permutation.
+ */
+int* partitionOrder(TGraph, int, int);
+
+/**
+ * @brief This function counts the edges of a graph whose endpoints fall in different partitions when the 
+ * vertices, in the given order, are split in partitions by graphPartitionRange().
+ */
+long long partitionCutEdges(TGraph, int*, int);
+
+#endif
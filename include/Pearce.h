@@ -0,0 +1,77 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file Pearce.h
+ * 
+ * @brief This is a header file for the implementation of the Pearce's algorithm for finding strongly 
+ * connected components (SCCs) in a directed graph. The algorithm is a variant of the Tarjan's algorithm 
+ * that keeps a single integer (rindex) and one bit per vertex instead of the discovery time, the low 
+ * value and the stack membership flag.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#ifndef PEARCE_H
+#define PEARCE_H
+
+#include <stdbool.h>
+
+#include "TGraph.h"
+#include "TArray.h"
+#include "Utils.h"
+#include "Trim.h"
+
+/**
+ * @brief This function performs an iterative depth-first search (DFS) from a given node of a graph, within a 
+ * specified range of vertices, assigning the rindex of the visited vertices and collecting the SCCs completed 
+ * during the search.
+ */
+void pearceVisit(TGraph, int, int*, uint64_t*, TDFSFrame*, int*, int*, int*, int, int, TSCCs*);
+
+/**
+ * @brief This function performs the Pearce's algorithm for finding strongly connected components (SCCs) in a 
+ * directed graph. The function returns the set of the SCCs.
+ */
+TSCCs pearce(TGraph, int, int);
+
+#endif
\ No newline at end of file
@@ -83,6 +83,16 @@ void arrayDestroy(TArray*);
  */
 void arrayResize(TArray*, int);
 
+/**
+ * @brief Makes room in the given TArray object for at least the specified number of elements.
+ */
+void arrayReserve(TArray*, int);
+
+/**
+ * @brief Appends the given TInfoInt objects to the end of the given TArray object.
+ */
+void arrayAppendN(TArray*, const TInfoInt*, int);
+
 /**
  * @brief Prints the contents of the given TArray object to stdout.
  */
@@ -41,9 +41,10 @@
  * @file TGraph.h
  * 
  * @brief Declarations for functions and data structures related to graph manipulation. This file 
- * contains declarations for the TGraph and Node data structures, as well as functions for creating 
- * and destroying graphs, adding edges, and printing graphs. It also includes a function for getting 
- * the neighbors of a given vertex in a graph.
+ * contains declarations for the TGraph data structure, stored in compressed sparse row (CSR) form, 
+ * and for the TGraphBuilder used to create it, as well as functions for creating and destroying 
+ * graphs and printing graphs. It also includes a function for getting the neighbors of a given 
+ * vertex in a graph.
  * 
  * @version 0.1
  * 
@@ -54,29 +55,121 @@
 #ifndef GRAPH_H
 #define GRAPH_H
 
+#include <stddef.h>
+
 #include "TArray.h"
 #include "TStack.h"
 
 /**
- * @brief A structure representing a node in a graph.
- * This structure contains a vertex identifier, a TArray of adjacent vertices, a TArray of connected 
- * components, and a flag indicating whether or not the node is a "macronode".
+ * @brief The magic string at the beginning of a graph file in binary format, used to tell it apart 
+ * from a graph file in text format.
  */
-typedef struct {
-    int vertex;
-    TArray adj;
-} Node;
+#define GRAPH_BINARY_MAGIC "SCCGRAPH"
+
+/**
+ * @brief The version of the binary format written by graphSaveBinary(). The loader rejects the files 
+ * with a different version.
+ */
+#define GRAPH_BINARY_VERSION 1
+
+/**
+ * @brief The magic string at the beginning of a permutation file, written next to a graph file in 
+ * binary format with the GRAPH_PERMUTATION_SUFFIX appended to its name.
+ */
+#define GRAPH_PERMUTATION_MAGIC "SCCPERM"
+
+/**
+ * @brief The version of the permutation format written by graphSavePermutation().
+ */
+#define GRAPH_PERMUTATION_VERSION 1
+
+/**
+ * @brief The suffix appended to the name of a graph file in binary format to get the name of its 
+ * permutation file.
+ */
+#define GRAPH_PERMUTATION_SUFFIX ".perm"
+
+/**
+ * @brief The weight of a vertex, relative to an edge, in the cost balanced among the partitions of a 
+ * graph by graphPartitionRange(). With 0 the partitions get the same number of edges, with large values 
+ * they get the same number of vertices.
+ */
+#ifndef GRAPH_PARTITION_VERTEX_WEIGHT
+#define GRAPH_PARTITION_VERTEX_WEIGHT 1
+#endif
+
+/**
+ * @brief The length from which an adjacency list is sorted with a radix sort instead of an insertion 
+ * sort when a graph is built.
+ */
+#ifndef GRAPH_RADIX_SORT_THRESHOLD
+#define GRAPH_RADIX_SORT_THRESHOLD 64
+#endif
+
+/**
+ * @brief The minimum number of bytes of a graph file in text format parsed by each thread, so that small 
+ * files are not split among more threads than they are worth.
+ */
+#ifndef GRAPH_PARSE_MIN_CHUNK
+#define GRAPH_PARSE_MIN_CHUNK (64 * 1024)
+#endif
 
 /**
- *  @brief A structure representing a graph.
- *  This structure contains the number of vertices in the graph and a pointer to an array of Node
- *  structures representing the vertices in the graph.
+ *  @brief A structure representing a graph in compressed sparse row (CSR) form.
+ *  The vertices are addressed by their dense position 0 ... vertices - 1 and the external identifiers 
+ *  are only used when the graph is loaded and when the results are produced. The structure contains 
+ *  the number of vertices, ghosts and edges in the graph and three arrays:
+ *  - ids: vertices + ghosts entries, the identifier of the vertex in position i. The first vertices 
+ *    entries are sorted in ascending order; the following ghosts entries, also sorted, are the 
+ *    identifiers of the vertices that are reached by an edge but do not belong to the graph;
+ *  - offsets: vertices + 1 entries, the neighbors of the vertex in position i are stored in 
+ *    targets[offsets[i]] ... targets[offsets[i + 1] - 1];
+ *  - targets: the positions of the neighbors of all the vertices, stored contiguously. A position 
+ *    greater than or equal to vertices denotes a ghost.
+ *  When the graph is loaded from a file in binary format, the three arrays point into a read-only 
+ *  memory mapping of the file, whose address and size are kept to unmap it; otherwise mapping is NULL 
+ *  and the arrays are allocated on the heap.
  */
 typedef struct SGraphNode {
     int vertices;
-    Node *nodes;
+    int ghosts;
+    int edges;
+    int *ids;
+    int *offsets;
+    int *targets;
+    void *mapping;
+    size_t mappingSize;
 } TGraphNode;
 
+/**
+ *  @brief The header of a graph file in binary format. The header is followed by the ids array 
+ *  (vertices + ghosts entries), the offsets array (vertices + 1 entries) and the targets array (edges 
+ *  entries) of the graph, stored as native 32-bit integers, so that they can be used in place once the 
+ *  file is mapped in memory. The size of the header is a multiple of 8 bytes, so the arrays are aligned.
+ */
+typedef struct {
+    char magic[8];
+    int version;
+    int vertices;
+    int ghosts;
+    int edges;
+    int reserved[2];
+} TGraphFileHeader;
+
+/**
+ *  @brief The header of a permutation file. The header is followed by the ids of the vertices of the 
+ *  graph in the order of the permutation (vertices entries) and by the prefix sum of their degrees in 
+ *  the same order (vertices + 1 entries), which plays the role of the offsets array when the permuted 
+ *  vertices are split in partitions by graphPartitionRange().
+ */
+typedef struct {
+    char magic[8];
+    int version;
+    int vertices;
+    int edges;
+    int reserved[3];
+} TGraphPermutationHeader;
+
 /**
  *  @brief A typedef for a pointer to a TGraphNode.
  *  This typedef is used to create a new type, TGraph, which is a pointer to a TGraphNode
@@ -85,42 +178,38 @@ typedef struct SGraphNode {
 typedef TGraphNode *TGraph;
 
 /**
- *  @brief Frees all memory associated with a Node structure.
- *  This function takes a pointer to a Node structure as input and frees all memory associated with
- *  the Node, including any memory allocated for its TArray fields.
- * 
- *  @param node A pointer to the Node to be destroyed.
+ *  @brief A structure used to build a TGraph one adjacency list at a time.
+ *  The vertices are added with graphBuilderAddVertex() and the edges added afterwards with 
+ *  graphBuilderAddEdge() belong to the last added vertex. The arrays grow geometrically, so 
+ *  building a graph costs a number of reallocations logarithmic in its size.
  */
-void graphNodeDestroy(Node *);
+typedef struct {
+    int vertices;
+    int edges;
+    int vertexCapacity;
+    int edgeCapacity;
+    int *ids;
+    int *offsets;
+    int *targets;
+} TGraphBuilder;
 
 /**
- * @brief Creates a new graph with a specified number of vertices.
- * This function takes an integer as input and creates a new graph with that many vertices. It
- * returns a pointer to the new TGraph.
+ * @brief Creates a new graph with a specified number of vertices and edges.
+ * This function allocates the arrays of a graph with the given number of vertices and edges. The 
+ * content of the arrays is left to the caller.
  * 
  * @param vertices The number of vertices in the new graph.
+ * @param edges The number of edges in the new graph.
  * @return A pointer to the new TGraph.
  */
-TGraph graphCreate(int);
-
-/**
- * @brief A comparator function for qsort().
- * This function takes two pointers to void as input and compares the values pointed to by the 
- * pointers. It is intended to be used as a comparator function for the qsort() function, and 
- * returns a value less than, equal to, or greater than 0 depending on whether the first value is 
- * less than, equal to, or greater than the second value, respectively.
- * 
- * @param a A pointer to the first value to be compared.
- * @param b A pointer to the second value to be compared.
- * @return An integer indicating the relative order of the values pointed to by a and b.
- */
-int compare(const void *, const void *);
+TGraph graphCreate(int, int);
 
 /**
  * @brief Populates a graph with data from a given file.
  * This function takes a pointer to a character array (i.e., a string) containing the name of a
  * file and reads the data in the file to populate a graph with vertices and edges. It returns a
- * pointer to the populated TGraph.
+ * pointer to the populated TGraph. Files in binary format are detected by their magic string and 
+ * loaded with graphLoadBinary().
  * 
  * @param filename A pointer to a character array containing the name of the file to be read.
  * @return A pointer to the populated TGraph.
@@ -128,24 +217,79 @@ int compare(const void *, const void *);
 TGraph popolateGraph(char *);
 
 /**
- * @brief Frees all memory associated with a TGraph.
- * This function takes a pointer to a TGraph as input and frees all memory associated with the
- * TGraph, including any memory allocated for its Node structures.
+ * This function reads only the given partition of a graph file: the returned graph holds the vertices 
+ * owned by the partition, and their neighbors owned by the other partitions are ghosts. Files in binary 
+ * format are split by number of edges and vertices, files in text format by size in bytes.
  * 
- * @param graph A pointer to the TGraph to be destroyed.
+ * @param filename A pointer to a character array containing the name of the file to be read.
+ * @param part The index of the partition to be read, between 0 and parts - 1.
+ * @param parts The number of partitions the graph is split in.
+ * @return A pointer to the TGraph holding the vertices of the partition.
  */
-void graphDestroy(TGraph);
+TGraph popolateGraphPartition(char *, int, int);
 
 /**
- * @brief Adds an edge between two vertices in a TGraph.
- * This function takes a pointer to a TGraph, and two integers representing the indices of the
- * vertices to be connected by an edge. It adds an edge between the vertices in the TGraph.
+ * @brief Loads a graph from a file in binary format.
+ * The file is mapped in memory read-only and the CSR arrays of the graph point into the mapping, 
+ * so the processes loading the same file on a node share its pages in the page cache.
  * 
- * @param graph A pointer to the TGraph.
- * @param u The index of the first vertex.
- * @param v The index of the second vertex.
+ * @param filename A pointer to a character array containing the name of the file to be loaded.
+ * @return A pointer to the loaded TGraph.
+ */
+TGraph graphLoadBinary(char *);
+
+/**
+ * This function computes the range of positions [start, stop) of the vertices owned by a partition 
+ * of a graph, splitting the vertices in contiguous ranges with roughly the same number of edges plus 
+ * GRAPH_PARTITION_VERTEX_WEIGHT times the number of vertices.
+ * 
+ * @param offsets The offsets array of the graph.
+ * @param vertices The number of vertices of the graph.
+ * @param part The index of the partition, between 0 and parts - 1.
+ * @param parts The number of partitions the graph is split in.
+ * @param start A pointer to an integer where the first position of the range is stored.
+ * @param stop A pointer to an integer where the position after the last one of the range is stored.
+ */
+void graphPartitionRange(const int *, int, int, int, int *, int *);
+
+/**
+ * This function loads only the vertices of a partition of a graph from a file in binary format, 
+ * turning their neighbors owned by the other partitions into ghosts. If an up-to-date permutation 
+ * file exists next to the graph file, the partitions are taken from the permuted order of the vertices.
+ * 
+ * @param filename A pointer to a character array containing the name of the file to be loaded.
+ * @param part The index of the partition to be loaded, between 0 and parts - 1.
+ * @param parts The number of partitions the graph is split in.
+ * @return A pointer to the TGraph holding the vertices of the partition.
+ */
+TGraph graphLoadBinaryPartition(char *, int, int);
+
+/**
+ * @brief Saves a graph to a file in binary format.
+ * 
+ * @param graph The TGraph to be saved.
+ * @param filename A pointer to a character array containing the name of the file to be written.
+ */
+void graphSaveBinary(TGraph, char *);
+
+/**
+ * @brief Saves a permutation of the vertices of a graph to a permutation file, which the partitioned 
+ * loader of the graph file in binary format uses in place of the order of the identifiers.
+ * 
+ * @param graph The TGraph whose vertices are permuted.
+ * @param order The positions of the vertices of the graph, in the order of the permutation.
+ * @param filename A pointer to a character array containing the name of the file to be written.
+ */
+void graphSavePermutation(TGraph, int *, char *);
+
+/**
+ * @brief Frees all memory associated with a TGraph.
+ * This function takes a pointer to a TGraph as input and frees all memory associated with the
+ * TGraph, including its CSR arrays, or unmaps the file they point into.
+ * 
+ * @param graph A pointer to the TGraph to be destroyed.
  */
-void graphAddEdge(TGraph*, int, int);
+void graphDestroy(TGraph);
 
 /**
  * @brief Prints a TGraph to the console.
@@ -156,15 +300,76 @@ void graphAddEdge(TGraph*, int, int);
  */
 void graphPrint(TGraph);
 
+/**
+ * @brief Gets the position of a given vertex in a TGraph.
+ * This function takes a TGraph and a vertex identifier and returns the position of the vertex in 
+ * the ids array, or -1 if the vertex does not belong to the graph. Ghosts are not considered.
+ * 
+ * @param graph The TGraph.
+ * @param vertex The identifier of the vertex.
+ * @return The position of the vertex, or -1.
+ */
+int graphIndexOf(TGraph, int);
+
 /**
  * @brief Gets the neighbors of a given vertex in a TGraph.
- * This function takes a pointer to a TGraph and an integer representing the index of a vertex,
- * and returns a pointer to a TArray containing the indices of the neighbors of the given vertex.
+ * This function takes a pointer to a TGraph and an integer representing the identifier of a vertex,
+ * and returns a pointer to the contiguous positions of the neighbors of the given vertex. The 
+ * identifiers of the neighbors are obtained through the ids array of the graph.
  * 
  * @param graph A pointer to the TGraph.
- * @param vertex The index of the vertex.
- * @return A pointer to a TArray containing the indices of the neighbors of the given vertex.
+ * @param vertex The identifier of the vertex.
+ * @param length A pointer to an integer where the number of neighbors is stored.
+ * @return A pointer to the positions of the neighbors of the given vertex, or NULL if the vertex is 
+ * not in the graph.
+ */
+int* getNeighbor(TGraph*, int, int*);
+
+/**
+ * @brief Creates a new graph builder.
+ * The number of vertices and edges are only hints for the initial capacity of the builder.
+ * 
+ * @param vertices The expected number of vertices.
+ * @param edges The expected number of edges.
+ * @return The new TGraphBuilder.
+ */
+TGraphBuilder graphBuilderCreate(int, int);
+
+/**
+ * @brief Adds a vertex to the graph being built.
+ * The edges added afterwards belong to this vertex.
+ * 
+ * @param builder A pointer to the TGraphBuilder.
+ * @param vertex The identifier of the vertex.
+ */
+void graphBuilderAddVertex(TGraphBuilder*, int);
+
+/**
+ * @brief Adds an edge from the last added vertex to the given vertex.
+ * 
+ * @param builder A pointer to the TGraphBuilder.
+ * @param vertex The identifier of the destination vertex.
+ */
+void graphBuilderAddEdge(TGraphBuilder*, int);
+
+/**
+ * @brief Adds a list of edges from the last added vertex to the given vertices.
+ * 
+ * @param builder A pointer to the TGraphBuilder.
+ * @param vertices The identifiers of the destination vertices.
+ * @param length The number of destination vertices.
+ */
+void graphBuilderAddEdges(TGraphBuilder*, int*, int);
+
+/**
+ * @brief Builds the TGraph from the content of a builder.
+ * The vertices are sorted by identifier, the identifiers of the neighbors are replaced by their 
+ * positions, every adjacency list is sorted and cleared of duplicated edges, and the arrays of the 
+ * builder are moved into the graph, so the builder must not be used anymore.
+ * 
+ * @param builder A pointer to the TGraphBuilder.
+ * @return The built TGraph.
  */
-TArray* getNeighbor(TGraph*, int);
+TGraph graphBuilderBuild(TGraphBuilder*);
 
-#endif 
\ No newline at end of file
+#endif
\ No newline at end of file
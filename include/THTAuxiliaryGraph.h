@@ -40,11 +40,11 @@
  * 
  * @file THTauxiliarySCC.h
  * 
- * @brief Header file for a hash table with open addressing and linear probing. This file contains 
- * the declarations of the functions and structures used to create and manipulate a hash table with 
- * open addressing and linear probing. The hash table is composed by an array of pointers to 
- * TInfoHTAuxiliaryGraph structures, an array of integers indicating which buckets are used, and two 
- * integers representing the number of buckets and the number of used buckets.
+ * @brief Header file for a hash table with open addressing. This file contains the declarations of 
+ * the functions and structures used to create and manipulate a hash table whose keys are TKeyHTAuxiliaryGraph 
+ * and whose values are TValueHTAuxiliaryGraph. The hash table wraps a THashTable, the table probed in groups of 
+ * control bytes shared by all the hash tables of the program, which stores the keys and the values 
+ * in two arrays of slots.
  * 
  * @version 0.1
  * 
@@ -56,54 +56,34 @@
 #define THTAUXILIARYGRAPH_H
 
 #include "TInfoHTAuxiliaryGraph.h"
+#include "THashTable.h"
 
 /**
- * @brief Maximum load factor of the hash table
- * The maximum load factor is the maximum ratio between the number of used buckets and the number 
- * of total buckets in the hash table. When this ratio is reached, the hash table is resized to a 
- * larger size.
- */
-#define MAX_LOAD 0.75
-
-/**
- * @brief Factor to grow the hash table when it reaches the maximum load
- * When the hash table reaches the maximum load, it is resized to a larger size by multiplying its 
- * current number of buckets by this factor.
- */
-#define GROW_FACTOR 2
-
-/**
- * @brief Structure to represent a hash table with open addressing and linear probing
- * This structure represents a hash table with open addressing and linear probing, composed by:
- * • bucket: an array of TInfoHTAuxiliaryGraph pointers;
- * • used: an array of integers, where 0 means that the bucket is empty and 1 means that the bucket 
- *   is used;
- * • n_bucket: the number of buckets;
- * • n_used: the number of used buckets.
+ * @brief Structure to represent a hash table with open addressing
+ * This structure wraps a THashTable whose values are TValueHTAuxiliaryGraph: the number of keys is table.count, 
+ * and a slot i of the table holds a key when HASH_TABLE_FULL(&table, i), table.keys[i] being the key 
+ * and hashTableValue(&table, i) pointing to its value.
  */
 typedef struct SHTAuxiliaryGraph {
-	TInfoHTAuxiliaryGraph* bucket; 
-	int* used;
-	int n_bucket;
-	int n_used;
+	THashTable table;
 } THTAuxiliaryGraph;
 
 /**
- * @brief Creates a new hash table with open addressing and linear probing
- * This function creates and returns a pointer to a new hash table with open addressing and linear 
- * probing, initialized with a number of buckets equal to the parameter n.
+ * @brief Creates a new hash table with open addressing
+ * This function creates and returns a pointer to a new hash table with open addressing, with room 
+ * for at least n keys before it grows.
  */
 THTAuxiliaryGraph* HTAuxiliaryGraphCreate(int);
 
 /**
- * @brief Deallocates the memory used by a hash table with open addressing and linear probing
+ * @brief Deallocates the memory used by a hash table with open addressing
  */
 void HTAuxiliaryGraphDestroy(THTAuxiliaryGraph*);
 
 /**
- * @brief Deletes a key-value pair from the hash table
- * This function deletes the key-value pair with the specified key from the hash table pointed 
- * to by ht.
+ * @brief Inserts a key-value pair in the hash table
+ * This function inserts the key-value pair in the hash table pointed to by ht, replacing the value 
+ * if the key is already present.
  */
 void HTAuxiliaryGraphInsert(THTAuxiliaryGraph*, TKeyHTAuxiliaryGraph, TValueHTAuxiliaryGraph);
 
@@ -128,9 +108,8 @@ TValueHTAuxiliaryGraph* HTAuxiliaryGraphSearch(THTAuxiliaryGraph*, TKeyHTAuxilia
 void HTAuxiliaryGraphPrint(THTAuxiliaryGraph*);
 
 /**
- * @brief Resizes the hash table to a larger size
- * This function resizes the hash table pointed to by ht to a larger size by multiplying its current number 
- * of buckets by the GROW_FACTOR macro.
+ * @brief Resizes the hash table
+ * This function rehashes the hash table pointed to by ht with room for at least n keys.
  */
 void HTAuxiliaryGraphResize(THTAuxiliaryGraph*, int);
 
@@ -0,0 +1,153 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file THashTable.h
+ * 
+ * @brief Header file for the open addressing hash table shared by THTSCCs, THTAuxiliaryGraph and 
+ * THTAuxiliarySCC. The keys are integers and the values are stored inline, with the size given when 
+ * the table is created. The table follows the layout of the Swiss tables: the capacity is a power of two, 
+ * every slot has a control byte, which is either empty, deleted or the 7 low bits of the hash of its 
+ * key, and the control bytes are probed HASH_TABLE_GROUP at a time, with SSE2 when available, so that a 
+ * single comparison finds the few slots of a group whose key may match.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#ifndef THASHTABLE_H
+#define THASHTABLE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief The number of control bytes probed at once.
+ */
+#define HASH_TABLE_GROUP 16
+
+/**
+ * @brief The control byte of an empty slot.
+ */
+#define HASH_TABLE_EMPTY ((int8_t) -128)
+
+/**
+ * @brief The control byte of a slot whose key has been deleted, which does not stop a search.
+ */
+#define HASH_TABLE_DELETED ((int8_t) -2)
+
+/**
+ * @brief The maximum load factor of the table, counting the deleted slots, as a fraction of 8: the table 
+ * is grown when 7/8 of its slots would be in use.
+ */
+#define HASH_TABLE_MAX_LOAD 7
+
+/**
+ * @brief Checks if a slot of a table holds a key.
+ */
+#define HASH_TABLE_FULL(table, slot) ((table)->control[slot] >= 0)
+
+/**
+ * @brief Structure to represent an open addressing hash table with integer keys, composed by:
+ * • control: capacity + HASH_TABLE_GROUP control bytes, the last HASH_TABLE_GROUP of which mirror the 
+ *   first ones, so that a group starting near the end of the table can be loaded at once;
+ * • keys: the key of every slot;
+ * • values: the value of every slot, valueSize bytes each;
+ * • capacity: the number of slots, a power of two;
+ * • count: the number of keys;
+ * • deleted: the number of deleted slots.
+ */
+typedef struct {
+    int8_t *control;
+    int *keys;
+    char *values;
+    int valueSize;
+    int capacity;
+    int count;
+    int deleted;
+} THashTable;
+
+/**
+ * @brief Creates a table with room for at least the given number of keys and values of the given size.
+ */
+THashTable hashTableCreate(int, int);
+
+/**
+ * @brief Destroys a table, releasing its arrays.
+ */
+void hashTableDestroy(THashTable*);
+
+/**
+ * @brief Computes the hash of a key.
+ */
+uint64_t hashTableHash(int);
+
+/**
+ * @brief Returns a pointer to the value of a key, or NULL if the key is not in the table.
+ */
+void* hashTableSearch(THashTable*, int);
+
+/**
+ * @brief Inserts a key with its value, replacing the value if the key is already in the table.
+ */
+void hashTableInsert(THashTable*, int, const void*);
+
+/**
+ * @brief Deletes a key from the table.
+ */
+void hashTableDelete(THashTable*, int);
+
+/**
+ * @brief Rehashes the table with room for at least the given number of keys.
+ */
+void hashTableResize(THashTable*, int);
+
+/**
+ * @brief Makes room in the table for at least the given number of keys, rehashing it only if needed.
+ */
+void hashTableReserve(THashTable*, int);
+
+/**
+ * @brief Returns a pointer to the value of a slot.
+ */
+void* hashTableValue(THashTable*, int);
+
+#endif
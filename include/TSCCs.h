@@ -0,0 +1,140 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file TSCCs.h
+ * 
+ * @brief Header file for the TSCCs module, which stores the strongly connected components (SCCs) found by 
+ * the algorithms in two flat arrays, the offsets of the components and their vertices, instead of a 
+ * dynamic array per component. A whole set of SCCs is then held by two allocations, created and released 
+ * in one call whatever the number of components, and can be copied or sent as it is. A set can also be 
+ * turned into a label per vertex, the index of its SCC, and saved in a binary labels file.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#ifndef TSCCS_H
+#define TSCCS_H
+
+#include "THTSCCs.h"
+
+/**
+ * @brief The magic string at the beginning of a labels file, written by sccsSaveLabels().
+ */
+#define SCCS_LABELS_MAGIC "SCCLABEL"
+
+/**
+ * @brief The version of the labels format written by sccsSaveLabels().
+ */
+#define SCCS_LABELS_VERSION 1
+
+/**
+ * @brief Struct defining a set of strongly connected components in compressed form.
+ * The vertices of the SCC i are vertices[offsets[i]] ... vertices[offsets[i + 1] - 1], so offsets has 
+ * count + 1 entries, the last of which is the number of vertices stored, size. Since every SCC has at 
+ * least one vertex, both arrays are allocated with room for capacity vertices (and capacity + 1 offsets).
+ */
+typedef struct {
+    int *offsets;
+    int *vertices;
+    int count;
+    int size;
+    int capacity;
+} TSCCs;
+
+/**
+ *  @brief The header of a labels file. The header is followed by the label of every vertex of the graph 
+ *  (vertices entries), in the order of the identifiers of the vertices, stored as native 32-bit integers: 
+ *  the index of the SCC of the vertex, between 0 and components - 1, or -1 for the identifiers that are not 
+ *  vertices of the graph. The size of the header is a multiple of 8 bytes, like the one of the graph files.
+ */
+typedef struct {
+    char magic[8];
+    int version;
+    int vertices;
+    int components;
+    int reserved[3];
+} TSCCsLabelsHeader;
+
+/**
+ * @brief Creates an empty set of SCCs with room for the given number of vertices.
+ */
+TSCCs sccsCreate(int);
+
+/**
+ * @brief Destroys the given set of SCCs, releasing its two arrays.
+ */
+void sccsDestroy(TSCCs*);
+
+/**
+ * @brief Makes room in the given set of SCCs for at least the specified number of vertices.
+ */
+void sccsReserve(TSCCs*, int);
+
+/**
+ * @brief Appends an SCC of the given length and returns where its vertices have to be written.
+ */
+int* sccsAppend(TSCCs*, int);
+
+/**
+ * @brief Appends an SCC of the given length from concurrent threads, within the capacity of the set, and 
+ * returns where its vertices have to be written.
+ */
+int* sccsAppendShared(TSCCs*, int);
+
+/**
+ * @brief Appends the given number of SCCs of one vertex and returns where their vertices have to be written.
+ */
+int* sccsAppendSingletons(TSCCs*, int);
+
+/**
+ * @brief Fills a caller-provided array with the index of the SCC of every original vertex, expanding the 
+ * macronodes through their hash table.
+ */
+void sccsLabel(TSCCs*, int, THTSCCs*, int*);
+
+/**
+ * @brief Saves the labels of the vertices of a graph in a labels file.
+ */
+void sccsSaveLabels(int*, int, int, char*);
+
+#endif
@@ -54,26 +54,27 @@
 #define TARJANPARALLEL_H
 
 #include "TGraph.h"
-#include "THTAuxiliarySCC.h"
 #include "THTSCCs.h"
 #include "THTAuxiliaryGraph.h"
 #include "Utils.h"
+#include "Trim.h"
 
 #define NOT_INITIALIZED -1
 
 /**
  * @brief Finds the strongly connected components (SCCs) in a graph
  * This function finds the strongly connected components (SCCs) in a graph
- * using the Tarjan's algorithm. It returns an array of nodes, where each
- * node represents a SCC and its children represent the nodes in the SCC. 
+ * using the Tarjan's algorithm. It returns the set of the SCCs, where the
+ * vertices of every SCC are stored contiguously. 
  */
-TArray* scc(TGraph, int, int, int*);
+TSCCs scc(TGraph, int, int);
 
 /**
- * @brief Recursive function to find the strongly connected components (SCCs) in a graph
- * This is a helper function for the SCC() function. It performs the
- * recursive DFS traversal of the graph to find the SCCs.
+ * @brief Iterative function to find the strongly connected components (SCCs) in a graph
+ * This is a helper function for the SCC() function. It performs the DFS traversal of the 
+ * graph to find the SCCs, keeping the call stack in an explicit buffer of frames so that 
+ * the depth of the traversal is not bounded by the stack of the thread.
  */
-void sccUtil(TGraph, int, THTAuxiliarySCC*, TStack*, int*, int, int, int*, TArray*);
+void sccUtil(TGraph, int, int*, int*, uint64_t*, TDFSFrame*, int*, int*, int*, int, int, TSCCs*);
 
 #endif
\ No newline at end of file
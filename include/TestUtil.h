@@ -53,14 +53,20 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 
 #include "../include/GraphGenerator.h"
 #include "../include/TArray.h"
+#include "../include/TSCCs.h"
 
 #define FILE_IN_GRAPH "../test/graphTest.txt"
+#define FILE_IN_GRAPH_BINARY "../test/graphTest.bin"
+#define FILE_IN_GRAPH_PERMUTATION "../test/graphTest.bin.perm"
 #define FILE_OUT_SEQ "../test/SCCSeqOut.txt"
 #define FILE_OUT_PAR "../test/SCCParOut.txt"
+#define FILE_OUT_LABELS_SEQ "../test/SCCSeqLabels.bin"
+#define FILE_OUT_LABELS_PAR "../test/SCCParLabels.bin"
 
 /**
  * @brief A struct for storing the results of the sequential and parallel implementations of 
@@ -102,4 +108,22 @@ TArray* readResult(char*, int*);
 */
 void compareResults(Results*);
 
+/**
+ * @brief Reads a labels file written by sccsSaveLabels, returning the labels and storing the number 
+ * of labels and of SCCs.
+*/
+int* readLabels(char*, int*, int*);
+
+/**
+ * @brief Checks that the labels of a labels file define the SCCs read from the output file of the 
+ * same run.
+*/
+void checkLabels(int*, int, int, TArray*, int);
+
+/**
+ * @brief Checks that the labels of the sequential and parallel implementations define the same 
+ * partition of the vertices.
+*/
+void compareLabels(int*, int*, int, int);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,78 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file Trim.h
+ * 
+ * @brief This is a header file for the trimming pre-pass shared by the algorithms to find the strongly 
+ * connected components (SCCs). The pre-pass removes from the cut, with OpenMP, the vertices that are 
+ * trivially SCCs on their own or in pairs, so that the algorithms only run on the remaining core of 
+ * the graph.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#ifndef TRIM_H
+#define TRIM_H
+
+#include <stdbool.h>
+
+#include "TGraph.h"
+#include "TSCCs.h"
+#include "Utils.h"
+
+/**
+ * @brief Maximum number of rounds of the trimming pre-pass. Every round costs a scan of the edges of the 
+ * vertices not removed yet, so long chains of trivial SCCs are left to the algorithms after this limit.
+ */
+#ifndef TRIM_MAX_ROUNDS
+#define TRIM_MAX_ROUNDS 16
+#endif
+
+/**
+ * @brief This function removes from a cut of a graph the vertices with in-degree or out-degree 0 and the 
+ * pairs of vertices forming a cycle of length 2, recording them as SCCs. It returns the number of vertices 
+ * removed.
+ */
+int trimGraph(TGraph, int, int, uint64_t*, TSCCs*);
+
+#endif
\ No newline at end of file
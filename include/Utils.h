@@ -53,47 +53,71 @@
 #define UTILS_H
 
 #include <stdio.h>
+#include <stdint.h>
 
 #include "TGraph.h"
 #include "THTSCCs.h"
 #include "THTAuxiliaryGraph.h"
+#include "TSCCs.h"
 
 /**
- * @brief This function calculates an id for a given vertex, rank, number of items, and offset.
+ * @brief Macros to handle a bitset stored as an array of 64-bit words, used by the algorithms to keep a 
+ * flag for every vertex of the cut with one bit per vertex. BITSET_WORDS gives the number of words needed 
+ * to store n flags, so a bitset can be cleared with a single memset of BITSET_WORDS(n) * sizeof(uint64_t) 
+ * bytes.
  */
-int calculateId(int, int, int, int*);
+#define BITSET_WORDS(n) (((n) + 63) / 64)
+#define BITSET_TEST(set, i) (((set)[(i) >> 6] >> ((i) & 63)) & 1)
+#define BITSET_SET(set, i) ((set)[(i) >> 6] |= (uint64_t)1 << ((i) & 63))
+#define BITSET_CLEAR(set, i) ((set)[(i) >> 6] &= ~((uint64_t)1 << ((i) & 63)))
 
 /**
- * @brief This function checks if a given vertex is in a cut of a given graph. 
+ * @brief The fan-in of the merge rounds of the parallel version: in every round the processes are split in 
+ * groups of MERGE_FAN_IN consecutive ranks, and the first rank of every group merges the condensed graphs of 
+ * the group. A fan-in of 2 gives the pairwise merge tree with log2(P) rounds, a fan-in not smaller than the 
+ * number of processes P gives a single all-to-one round.
  */
-bool isInCut(TGraph*, int, int, int);
+#ifndef MERGE_FAN_IN
+#define MERGE_FAN_IN 4
+#endif
 
 /**
- * @brief Returns the minimum of two integers
+ * @brief A frame of an iterative depth-first search: the position of the vertex being visited and the 
+ * index in the CSR targets of the next edge of the vertex to be explored.
  */
-int min(int, int);
+typedef struct {
+    int vertex;
+    int edge;
+} TDFSFrame;
 
 /**
- * @brief Creates a new graph
+ * @brief This function calculates the id of a new macronode, as the next id of the block reserved by the rank.
  */
-void createNewGraph(TGraph *, TGraph*, TGraph*, TGraph*, THTSCCs*, THTAuxiliaryGraph*, int*, int, int);
+int calculateId(int, int*);
 
 /**
- * @brief This function returns the adjacency list of a given vertex in a given graph.
+ * @brief This function checks if a given vertex is in a cut of a graph. The vertices are addressed by their 
+ * dense position and the ghosts are stored after the vertices, so the check is a comparison of the position 
+ * with the bounds of the cut. It is inline, since every algorithm calls it for every edge it visits.
  */
-TArray* getAdjacencyList(int, TGraph*, TGraph*, TGraph*, int);
+static inline bool isInCut(int vertex, int start, int stop) {
+    return start <= vertex && vertex < stop;
+}
+
+/**
+ * @brief Returns the minimum of two integers
+ */
+int min(int, int);
 
 /**
- * @brief This function serializes an array of strongly connected components (sccs) into a one-dimensional 
- * array of integers (buf).
+ * @brief Condenses a graph, replacing every SCC with a single node.
  */
-int* serializeSCCs(TArray*, int, int*);
+TGraph createNewGraph(TGraph, TSCCs*, int*, THTAuxiliaryGraph*);
 
 /**
- * @brief This function deserializes an array of strongly connected components (SCCs) that were previously 
- * serialized.
+ * @brief Merges the condensed graphs of the ranks of a group into a single graph.
  */
-void deserializeSCCs(TArray*, int*, int, int*);
+TGraph mergeGraphs(TGraph*, int, THTAuxiliaryGraph*);
 
 /**
  * @brief This function serializes an hash table of strongly connected components (sccs) into a one-dimensional 
@@ -116,14 +140,4 @@ int* serializeAuxiliaryGraphHT(THTAuxiliaryGraph*, int*);
  */
 void deserializeAuxiliaryGraphHT(THTAuxiliaryGraph*, int*);
 
-/**
- * @brief This function serializes a graph into an array of integers
- */
-int* serializeGraph(TGraph*, int*);
-
-/**
- * @brief This function deserializes a graph from an array of integers
- */
-TGraph deserializeGraph(int*, int);
-
 #endif 
\ No newline at end of file
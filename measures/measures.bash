@@ -28,8 +28,8 @@
 # If not, see <http://www.gnu.org/licenses/>.
 #
 
-# This script is used for benchmarking the performance of two algorithms, Tarjan and Kosaraju, 
-# for finding strongly connected components in a graph. The script generates graphs with different 
+# This script is used for benchmarking the performance of three algorithms, Tarjan, Kosaraju and 
+# coloring, for finding strongly connected components in a graph. The script generates graphs with different 
 # numbers of vertices and edges, and then runs the algorithms on those graphs using different numbers 
 # of MPI processes and OpenMP threads. The script also has some options for optimization. 
 # The script continues by iterating through different optimization options, graph dimensions, MPI 
@@ -109,6 +109,8 @@ function execMeasure {
                             echo "processes,tarjan_time,comm_time,elapsed" >$OUT_FILE
                         elif [ $ALGORITHM == "kosaraju" ]; then
                             echo "processes,kosaraju_time,comm_time,elapsed" >$OUT_FILE
+                        elif [ $ALGORITHM == "coloring" ]; then
+                            echo "processes,coloring_time,comm_time,elapsed" >$OUT_FILE
                         fi
                         
                         echo DIM_${VERTEX}_LB_${lowerBound}_HB_${upperBound}_MPI_${MPI_PROCESSES[index]}_OMP_00
@@ -119,6 +121,8 @@ function execMeasure {
                                     $1/tarjanSequentialO$opt $fileName >> $OUT_FILE
                                 elif [ $ALGORITHM == "kosaraju" ]; then
                                     $1/kosarajuSequentialO$opt $fileName >> $OUT_FILE
+                                elif [ $ALGORITHM == "coloring" ]; then
+                                    $1/coloringSequentialO$opt $fileName >> $OUT_FILE
                                 fi
 
                                 printf "\r> %d/%d %3.1d%% " $(expr $k + 1) $NUM_MEASURES $(expr \( \( $k + 1 \) \* 100 \) / $NUM_MEASURES)
@@ -142,6 +146,8 @@ function execMeasure {
                             echo "processes,tarjan_time,comm_time,elapsed" >$OUT_FILE
                         elif [ $ALGORITHM == "kosaraju" ]; then
                             echo "processes,kosaraju_time,comm_time,elapsed" >$OUT_FILE
+                        elif [ $ALGORITHM == "coloring" ]; then
+                            echo "processes,coloring_time,comm_time,elapsed" >$OUT_FILE
                         fi
 
                         echo DIM_${VERTEX}_LB_${lowerBound}_HB_${upperBound}_MPI_${MPI_PROCESSES[index]}_OMP_${OPENMP_THREADS[indexOmp]}
@@ -152,6 +158,8 @@ function execMeasure {
                                 mpirun.mpich -np ${MPI_PROCESSES[index]} $1/tarjanParallelO$opt ${OPENMP_THREADS[indexOmp]} $fileName  >> $OUT_FILE
                             elif [ $ALGORITHM == "kosaraju" ]; then
                                 mpirun.mpich -np ${MPI_PROCESSES[index]} $1/kosarajuParallelO$opt ${OPENMP_THREADS[indexOmp]} $fileName  >> $OUT_FILE
+                            elif [ $ALGORITHM == "coloring" ]; then
+                                mpirun.mpich -np ${MPI_PROCESSES[index]} $1/coloringParallelO$opt ${OPENMP_THREADS[indexOmp]} $fileName  >> $OUT_FILE
                             fi
                             printf "\r> %d/%d %3.1d%% " $(expr $k + 1) $NUM_MEASURES $(expr \( \( $k + 1 \) \* 100 \) / $NUM_MEASURES)
                             printf "#%.0s" $(seq -s " " 1 $(expr \( $k \* 40 \) / $NUM_MEASURES))
@@ -183,3 +191,9 @@ execMeasure "$1" "$OPTIMIZATION_OPTS" VECT_MPI_PROCESSES VECT_OPENMP_THREADS "$A
 execMeasure "$1" "$OPTIMIZATION_OPTS" VECT_MPI_PROCESSES VECT_OPENMP_THREADS "$ALGORITHM" "$VERTEX_2" LB_2 HB_2 "$SCRIPTPATH" 
 execMeasure "$1" "$OPTIMIZATION_OPTS" VECT_MPI_PROCESSES VECT_OPENMP_THREADS "$ALGORITHM" "$VERTEX_3" LB_3 HB_3 "$SCRIPTPATH" 
 execMeasure "$1" "$OPTIMIZATION_OPTS" VECT_MPI_PROCESSES VECT_OPENMP_THREADS "$ALGORITHM" "$VERTEX_4" LB_4 HB_4 "$SCRIPTPATH" 
+
+ALGORITHM="coloring"
+execMeasure "$1" "$OPTIMIZATION_OPTS" VECT_MPI_PROCESSES VECT_OPENMP_THREADS "$ALGORITHM" "$VERTEX_1" LB_1 HB_1 "$SCRIPTPATH" 
+execMeasure "$1" "$OPTIMIZATION_OPTS" VECT_MPI_PROCESSES VECT_OPENMP_THREADS "$ALGORITHM" "$VERTEX_2" LB_2 HB_2 "$SCRIPTPATH" 
+execMeasure "$1" "$OPTIMIZATION_OPTS" VECT_MPI_PROCESSES VECT_OPENMP_THREADS "$ALGORITHM" "$VERTEX_3" LB_3 HB_3 "$SCRIPTPATH" 
+execMeasure "$1" "$OPTIMIZATION_OPTS" VECT_MPI_PROCESSES VECT_OPENMP_THREADS "$ALGORITHM" "$VERTEX_4" LB_4 HB_4 "$SCRIPTPATH" 
@@ -0,0 +1,242 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file BenchmarkHashTable.c
+ * 
+ * @brief This is a C file containing a microbenchmark of the hash tables: it times the inserts, the 
+ * successful searches and the failed searches of THashTable against the linear probing table with the 
+ * identity hash that the hash tables of the program used before, on the keys they actually get.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include <omp.h>
+
+#include "../include/THashTable.h"
+
+/**
+ * @brief The default number of keys of a run.
+ */
+#define BENCHMARK_KEYS (1 << 18)
+
+/**
+ * @brief The number of processes whose macronode ids are interleaved in the clustered keys.
+ */
+#define BENCHMARK_PROCESSES 8
+
+/**
+ * @brief The linear probing table the hash tables of the program used to be, kept here as the baseline: the 
+ * key is its own hash, reduced modulo the number of buckets, and an array of flags marks the used buckets.
+ */
+typedef struct {
+    int* keys;
+    int* values;
+    int* used;
+    int n_bucket;
+    int n_used;
+} TLinearTable;
+
+static TLinearTable linearTableCreate(int n) {
+    TLinearTable ht;
+    ht.keys = malloc(n * sizeof(int));
+    ht.values = malloc(n * sizeof(int));
+    ht.used = calloc(n, sizeof(int));
+    assert(ht.keys != NULL && ht.values != NULL && ht.used != NULL);
+    ht.n_bucket = n;
+    ht.n_used = 0;
+    return ht;
+}
+
+static void linearTableDestroy(TLinearTable* ht) {
+    free(ht->keys);
+    free(ht->values);
+    free(ht->used);
+}
+
+static int* linearTableSearch(TLinearTable* ht, int key) {
+    unsigned h = (unsigned) key % ht->n_bucket;
+    while (ht->used[h] && ht->keys[h] != key)
+        h = (h + 1) % ht->n_bucket;
+    return ht->used[h] ? &ht->values[h] : NULL;
+}
+
+static void linearTableInsert(TLinearTable* ht, int key, int value);
+
+static void linearTableResize(TLinearTable* ht, int n) {
+    TLinearTable old = *ht;
+    *ht = linearTableCreate(n);
+    for (int i = 0; i < old.n_bucket; i++)
+        if (old.used[i])
+            linearTableInsert(ht, old.keys[i], old.values[i]);
+    linearTableDestroy(&old);
+}
+
+static void linearTableInsert(TLinearTable* ht, int key, int value) {
+    int* p = linearTableSearch(ht, key);
+    if (p != NULL) {
+        *p = value;
+        return;
+    }
+    if (ht->n_used + 1 >= ht->n_bucket * 0.75)
+        linearTableResize(ht, ht->n_bucket * 2 + 1);
+    unsigned h = (unsigned) key % ht->n_bucket;
+    while (ht->used[h])
+        h = (h + 1) % ht->n_bucket;
+    ht->keys[h] = key;
+    ht->values[h] = value;
+    ht->used[h] = 1;
+    ht->n_used++;
+}
+
+/**
+ * Fills the keys of a workload. The clustered keys are the ones of the merge rounds: every process numbers 
+ * its macronodes consecutively from a base of its own, as calculateId() does, so the keys are runs of 
+ * consecutive integers at regular distances. The random keys are spread over all the integers.
+ *
+ * @param keys The array to fill
+ * @param n The number of keys
+ * @param clustered If true the keys are clustered, otherwise they are random
+ * @param seed The seed of the random keys
+ */
+static void benchmarkKeys(int* keys, int n, bool clustered, unsigned seed) {
+    int run = n / BENCHMARK_PROCESSES + 1;
+    srand(seed);
+    for (int i = 0; i < n; i++)
+        keys[i] = clustered ? (i % BENCHMARK_PROCESSES) * (2 * run) + i / BENCHMARK_PROCESSES
+                            : (int) (((unsigned) rand() << 16 ^ (unsigned) rand()) & 0x7FFFFFFF);
+}
+
+/**
+ * Times the inserts of all the keys, then the searches of all of them and the searches of as many keys 
+ * that are not in the table, on both tables, and prints the times and the speedup of THashTable.
+ *
+ * @param name The name of the workload
+ * @param keys The keys to insert
+ * @param misses The keys to search that are not inserted
+ * @param n The number of keys
+ */
+static void benchmarkRun(const char* name, int* keys, int* misses, int n) {
+    double linear[3], swiss[3], start;
+    long long found = 0;
+
+    start = omp_get_wtime();
+    TLinearTable linearTable = linearTableCreate(16);
+    for (int i = 0; i < n; i++)
+        linearTableInsert(&linearTable, keys[i], i);
+    linear[0] = omp_get_wtime() - start;
+    start = omp_get_wtime();
+    for (int i = 0; i < n; i++)
+        found += linearTableSearch(&linearTable, keys[i]) != NULL;
+    linear[1] = omp_get_wtime() - start;
+    start = omp_get_wtime();
+    for (int i = 0; i < n; i++)
+        found += linearTableSearch(&linearTable, misses[i]) != NULL;
+    linear[2] = omp_get_wtime() - start;
+    linearTableDestroy(&linearTable);
+
+    start = omp_get_wtime();
+    THashTable table = hashTableCreate(16, sizeof(int));
+    for (int i = 0; i < n; i++)
+        hashTableInsert(&table, keys[i], &i);
+    swiss[0] = omp_get_wtime() - start;
+    start = omp_get_wtime();
+    for (int i = 0; i < n; i++)
+        found += hashTableSearch(&table, keys[i]) != NULL;
+    swiss[1] = omp_get_wtime() - start;
+    start = omp_get_wtime();
+    for (int i = 0; i < n; i++)
+        found += hashTableSearch(&table, misses[i]) != NULL;
+    swiss[2] = omp_get_wtime() - start;
+    hashTableDestroy(&table);
+
+    const char* operations[] = {"insert", "hit", "miss"};
+    for (int k = 0; k < 3; k++)
+        printf("%-10s %-7s %10.2f %10.2f %8.2fx\n", name, operations[k], 1e9 * linear[k] / n, 1e9 * swiss[k] / n, linear[k] / swiss[k]);
+    if (found < n)
+        fprintf(stderr, "Errore: chiavi non trovate\n");
+}
+
+/** 
+ * The program takes in an optional command-line argument, the number of keys of every workload, and runs 
+ * the clustered and the random workloads, printing for every operation the nanoseconds per key of the 
+ * linear probing table and of THashTable. The misses of the clustered workload are the gaps between the 
+ * runs of consecutive keys, which is where the ghosts of the other processes fall.
+ */
+int main(int argc, char** argv) {
+
+  if(argc > 2){
+    fprintf(stderr,"Usage:\n\t%s [keys]\n", argv[0]);
+    exit(EXIT_FAILURE);
+  }
+
+  int n = argc == 2 ? atoi(argv[1]) : BENCHMARK_KEYS;
+  int* keys = malloc(n * sizeof(int));
+  int* misses = malloc(n * sizeof(int));
+  assert(keys != NULL && misses != NULL);
+
+  printf("%-10s %-7s %10s %10s %9s\n", "keys", "op", "linear ns", "swiss ns", "speedup");
+
+  benchmarkKeys(keys, n, true, 0);
+  int run = n / BENCHMARK_PROCESSES + 1;
+  for (int i = 0; i < n; i++)
+    misses[i] = keys[i] + run;
+  benchmarkRun("clustered", keys, misses, n);
+
+  benchmarkKeys(keys, n, false, 1);
+  benchmarkKeys(misses, n, false, 2);
+  for (int i = 0; i < n; i++)
+    misses[i] |= 1 << 30;
+  for (int i = 0; i < n; i++)
+    keys[i] &= ~(1 << 30);
+  benchmarkRun("random", keys, misses, n);
+
+  free(keys);
+  free(misses);
+
+  exit(EXIT_SUCCESS);
+
+}
@@ -0,0 +1,318 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file Coloring.c
+ * 
+ * @brief Source file for the coloring algorithm to find the strongly connected components (SCCs) of a 
+ * directed graph. The algorithm takes in a TGraph (a graph data structure), start and stop indices, 
+ * and returns the SCCs found in a TSCCs set, like the other algorithms. Every vertex 
+ * starts with its own position as color, and the maximum color is propagated forward along the edges 
+ * until a fixpoint: the vertices keeping their own color are the roots, and every vertex gets the 
+ * color of the greatest root reaching it. The SCC of a root is then the set of the vertices of its 
+ * color that reach it, found by a backward search restricted to the color. The searches of different 
+ * roots are independent and run in parallel, and the step is repeated on the remaining vertices. 
+ * Unlike FW-BW, the parallelism does not depend on splitting the graph into large subproblems, so the 
+ * algorithm is effective on graphs with many small SCCs.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <omp.h>
+
+#include "../include/Coloring.h"
+#include "../include/Kosaraju.h"
+
+/**
+ * This function raises the color of a vertex to a given value, if it is lower. The update is done with a 
+ * compare-and-swap loop, so that concurrent raises keep the maximum. Vertices whose SCC has been found are 
+ * never recolored.
+ * 
+ * @param color A pointer to the color of the vertex
+ * @param value The new color
+ * @return true if the color has been raised, false otherwise
+*/
+static bool coloringRaise(int *color, int value) {
+
+    int old = *color;
+
+    while(old != COLORING_DONE && old < value) {
+        if(__sync_bool_compare_and_swap(color, old, value))
+            return true;
+        old = *color;
+    }
+
+    return false;
+}
+
+/**
+ * This function expands a vertex of the frontier of the forward propagation. The color of the vertex is 
+ * pushed to all its neighbors in the cut, and every neighbor whose color is raised is appended to the next 
+ * frontier, unless it has already been appended in the same step. The mark of the step is set with a 
+ * compare-and-swap and the slot of the frontier is reserved with an atomic increment, so that the function 
+ * can be called by several threads at once.
+ * 
+ * @param graph The graph
+ * @param vertex The position of the vertex to expand
+ * @param color The colors of the vertices of the cut
+ * @param mark The last step in which every vertex of the cut has been appended to a frontier
+ * @param next The next frontier
+ * @param nextLength A pointer to the length of the next frontier
+ * @param step The current step
+ * @param start The start of the cut range
+ * @param stop The end of the cut range
+*/
+static void coloringExpand(TGraph graph, int vertex, int *color, int *mark, int *next, int *nextLength, int step, int start, int stop) {
+
+    int value = color[vertex - start];
+
+    for(int j = graph->offsets[vertex]; j < graph->offsets[vertex + 1]; j++) {
+        int t = graph->targets[j];
+        if(!isInCut(t, start, stop) || !coloringRaise(&color[t - start], value))
+            continue;
+        int old = mark[t - start];
+        if(old != step && __sync_bool_compare_and_swap(&mark[t - start], old, step))
+            next[__sync_fetch_and_add(nextLength, 1)] = t;
+    }
+}
+
+/**
+ * This function propagates forward the maximum color along the edges of a graph, until a fixpoint is reached. 
+ * The first frontier contains all the active vertices, each colored with its own position. At every step the 
+ * vertices of the frontier push their color to their neighbors, and the neighbors whose color is raised form the 
+ * next frontier; frontiers with more than COLORING_FRONTIER_CUTOFF vertices are expanded by all the threads. At 
+ * the end, the color of every active vertex is the greatest position of an active vertex reaching it.
+ * 
+ * @param graph The graph
+ * @param color The colors of the vertices of the cut, COLORING_DONE for the vertices whose SCC has been found
+ * @param mark The last step in which every vertex of the cut has been appended to a frontier
+ * @param frontier A buffer with one entry per vertex of the cut, holding the active vertices at the beginning
+ * @param next A buffer with one entry per vertex of the cut
+ * @param length The number of active vertices
+ * @param start The start of the cut range
+ * @param stop The end of the cut range
+ * @param step A pointer to the step counter, shared by all the propagations so that the marks stay valid
+*/
+void coloringPropagate(TGraph graph, int *color, int *mark, int *frontier, int *next, int length, int start, int stop, int *step) {
+
+    #pragma omp parallel for
+    for(int i = 0; i < length; i++)
+        color[frontier[i] - start] = frontier[i];
+
+    while(length > 0) {
+        int nextLength = 0;
+
+        (*step)++;
+
+        #pragma omp parallel for schedule(dynamic, 256) if(length > COLORING_FRONTIER_CUTOFF)
+        for(int i = 0; i < length; i++)
+            coloringExpand(graph, frontier[i], color, mark, next, &nextLength, *step, start, stop);
+
+        int *swap = frontier;
+        frontier = next;
+        next = swap;
+        length = nextLength;
+    }
+}
+
+/**
+ * This function collects the SCC of a root. The SCC contains the vertices with the color of the root that reach 
+ * it, so it is found with a breadth-first search on the transpose of the graph that only enters the vertices 
+ * with that color. The visited vertices are colored with COLORING_DONE, and the queue of the search, which at 
+ * the end contains exactly the vertices of the SCC, is appended to the set of SCCs. The queue is owned by the 
+ * calling thread and is doubled whenever it is full.
+ * 
+ * @param graph The graph
+ * @param transpose The transpose of the graph restricted to the cut
+ * @param color The colors of the vertices of the cut
+ * @param root The position of the root
+ * @param queue A pointer to the queue of the search
+ * @param capacity A pointer to the capacity of the queue
+ * @param start The start of the cut range
+ * @param stop The end of the cut range
+ * @param sccs The set where the SCC is stored, shared with the other threads
+*/
+void coloringCollect(TGraph graph, TGraph transpose, int *color, int root, int **queue, int *capacity, int start, int stop, TSCCs *sccs) {
+
+    int head = 0, tail = 0;
+
+    (*queue)[tail++] = root;
+    color[root - start] = COLORING_DONE;
+
+    while(head < tail) {
+        int v = (*queue)[head++];
+        for(int j = transpose->offsets[v]; j < transpose->offsets[v + 1]; j++) {
+            int t = transpose->targets[j];
+            if(!isInCut(t, start, stop) || color[t - start] != root)
+                continue;
+            if(tail == *capacity) {
+                *capacity *= 2;
+                *queue = (int *) realloc(*queue, *capacity * sizeof(int));
+                assert(*queue != NULL);
+            }
+            color[t - start] = COLORING_DONE;
+            (*queue)[tail++] = t;
+        }
+    }
+
+    int *members = sccsAppendShared(sccs, tail);
+    for(int i = 0; i < tail; i++)
+        members[i] = graph->ids[(*queue)[i]];
+}
+
+/**
+ * This function performs a round of the coloring algorithm on the active vertices of a cut. It propagates the 
+ * colors forward with the "coloringPropagate" function, collects in parallel the roots, that is the vertices 
+ * keeping their own position as color, and calls the "coloringCollect" function on every root in parallel, 
+ * since the roots have different colors. The vertices of the SCCs found are colored with COLORING_DONE, and the 
+ * other ones are compacted at the beginning of the list of the active vertices. At least the SCC of the greatest 
+ * active vertex is found in every round.
+ * 
+ * @param graph The graph
+ * @param transpose The transpose of the graph restricted to the cut
+ * @param color The colors of the vertices of the cut, COLORING_DONE for the vertices whose SCC has been found
+ * @param mark The last step in which every vertex of the cut has been appended to a frontier
+ * @param active The list of the active vertices, which is updated
+ * @param frontier A buffer with one entry per vertex of the cut
+ * @param next A buffer with one entry per vertex of the cut
+ * @param length The number of active vertices
+ * @param start The start of the cut range
+ * @param stop The end of the cut range
+ * @param step A pointer to the step counter of the propagations
+ * @param sccs The set where the SCCs found are stored
+ * @return The number of vertices still active
+*/
+int coloringStep(TGraph graph, TGraph transpose, int *color, int *mark, int *active, int *frontier, int *next, int length, int start, int stop, int *step, TSCCs *sccs) {
+
+    int roots = 0, kept = 0;
+
+    memcpy(frontier, active, length * sizeof(int));
+    coloringPropagate(graph, color, mark, frontier, next, length, start, stop, step);
+
+    #pragma omp parallel for
+    for(int i = 0; i < length; i++) {
+        if(color[active[i] - start] == active[i])
+            frontier[__sync_fetch_and_add(&roots, 1)] = active[i];
+    }
+
+    #pragma omp parallel
+    {
+        int capacity = 64;
+        int *queue = (int *) malloc(capacity * sizeof(int));
+        assert(queue != NULL);
+
+        #pragma omp for schedule(dynamic, 1)
+        for(int i = 0; i < roots; i++)
+            coloringCollect(graph, transpose, color, frontier[i], &queue, &capacity, start, stop, sccs);
+
+        free(queue);
+    }
+
+    for(int i = 0; i < length; i++) {
+        if(color[active[i] - start] != COLORING_DONE)
+            active[kept++] = active[i];
+    }
+
+    return kept;
+}
+
+/**
+ * This function is an implementation of the coloring algorithm to find the strongly connected components (SCCs) 
+ * in a given range of vertices of a graph.
+ * 
+ *  1.The function starts by creating the transpose of the graph restricted to the cut, by calling the 
+ *    "transposeGraph" function, and a set, called "sccs", to store the SCCs that are found, with room for all 
+ *    the vertices of the cut.
+ *  2.It runs the trimming pre-pass ("trimGraph"), which records the trivial SCCs of the cut. Their vertices get 
+ *    the color COLORING_DONE, and the other vertices of the cut are the active ones.
+ *  3.While there are active vertices, it performs a round of the algorithm by calling the "coloringStep" 
+ *    function.
+ *  4.Finally, it frees the memory allocated for the buffers and the transposed graph, and returns the set of 
+ *    SCCs.
+ * 
+ * @param graph The graph on which to perform the coloring algorithm
+ * @param start The lower bound of the range in which to search for SCCs
+ * @param stop The upper bound of the range in which to search for SCCs
+ * @return The set of SCCs
+ */
+TSCCs coloring(TGraph graph, int start, int stop) {
+
+    int dim = stop - start;
+    int size = dim > 0 ? dim : 1;
+    TGraph transpose = transposeGraph(&graph, start, stop);
+    TSCCs sccs = sccsCreate(dim);
+    uint64_t *trimmed = (uint64_t *) calloc(BITSET_WORDS(dim) + 1, sizeof(uint64_t));
+    int *color = (int *) malloc(size * sizeof(int));
+    int *mark = (int *) calloc(size, sizeof(int));
+    int *active = (int *) malloc(size * sizeof(int));
+    int *frontier = (int *) malloc(size * sizeof(int));
+    int *next = (int *) malloc(size * sizeof(int));
+    assert(trimmed != NULL && color != NULL && mark != NULL && active != NULL && frontier != NULL && next != NULL);
+    int length = 0, step = 0;
+
+    trimGraph(graph, start, stop, trimmed, &sccs);
+
+    for(int i = 0; i < dim; i++) {
+        if(BITSET_TEST(trimmed, i))
+            color[i] = COLORING_DONE;
+        else
+            active[length++] = start + i;
+    }
+
+    free(trimmed);
+
+    while(length > 0)
+        length = coloringStep(graph, transpose, color, mark, active, frontier, next, length, start, stop, &step, &sccs);
+
+    free(color);
+    free(mark);
+    free(active);
+    free(frontier);
+    free(next);
+    graphDestroy(transpose);
+
+    return sccs;
+}
@@ -0,0 +1,533 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file Communication.c
+ * 
+ * @brief Source file for the transfers of the merge rounds. Instead of a blocking message with the size 
+ * followed by a blocking message with the data, every buffer is split in chunks sent with nonblocking 
+ * operations, and the receiver always keeps posted the receive of the next chunk of every stream, so that 
+ * the transfers of all the processes of a group proceed together and a stream can be deserialized as soon 
+ * as it is complete. The large buffers are sent compressed, and decompressed by the receiver as soon as their 
+ * stream is complete. The processes running on the same node do not use messages at all: each one publishes 
+ * its payloads in a segment of a shared memory window, which the first process of its group reads in place.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+
+#include "../include/Communication.h"
+#include "../include/Compression.h"
+#include "../include/Utils.h"
+
+/**
+ * This function creates an empty set of pending sends.
+ * 
+ * @return The empty set of pending sends
+*/
+TChunkedSend chunkedSendCreate() {
+
+    TChunkedSend pending;
+    pending.requests = NULL;
+    pending.count = 0;
+    pending.capacity = 0;
+    pending.header[0] = pending.header[1] = pending.header[2] = pending.header[3] = 0;
+    pending.ownedCount = 0;
+    return pending;
+}
+
+/**
+ * This function posts with MPI_Isend the chunks of a buffer: size / COMM_CHUNK_SIZE full chunks followed by a 
+ * last chunk with the remaining integers, which is sent even when it is empty, since a chunk shorter than 
+ * COMM_CHUNK_SIZE is what tells the receiver that the stream is over. The requests are added to the pending 
+ * sends, and the buffer must not be modified or freed until chunkedSendWait() returns.
+ * 
+ * @param pending The pending sends
+ * @param buffer The buffer to send
+ * @param size The number of integers of the buffer
+ * @param dest The rank of the receiver
+ * @param tag The tag of the stream
+ * @param comm The communicator
+*/
+void chunkedSend(TChunkedSend* pending, int* buffer, int size, int dest, int tag, MPI_Comm comm) {
+
+    int chunks = size / COMM_CHUNK_SIZE + 1;
+
+    if(pending->count + chunks > pending->capacity) {
+        pending->capacity = 2 * (pending->count + chunks);
+        pending->requests = (MPI_Request*)realloc(pending->requests, pending->capacity * sizeof(MPI_Request));
+        assert(pending->requests != NULL);
+    }
+
+    for(int c = 0; c < chunks; c++) {
+        int first = c * COMM_CHUNK_SIZE;
+        int count = min(COMM_CHUNK_SIZE, size - first);
+        MPI_Isend(buffer + first, count, MPI_INT, dest, tag, comm, &pending->requests[pending->count++]);
+    }
+}
+
+/**
+ * This function compresses a buffer if it has at least COMM_COMPRESSION_THRESHOLD integers and the compressed 
+ * buffer is smaller, in which case the compressed buffer is added to the buffers owned by the pending sends.
+ * 
+ * @param pending The pending sends
+ * @param buffer The buffer
+ * @param size A pointer to the number of integers of the buffer, updated if the buffer is compressed
+ * @return The compressed buffer, or NULL if the buffer has to be sent as it is
+*/
+static int* chunkedSendCompress(TChunkedSend* pending, int* buffer, int* size) {
+
+    if(*size < COMM_COMPRESSION_THRESHOLD)
+        return NULL;
+
+    int compressedSize;
+    int* compressed = compressInts(buffer, *size, &compressedSize);
+    if(compressed == NULL)
+        return NULL;
+
+    assert(pending->ownedCount < COMM_STREAMS);
+    pending->owned[pending->ownedCount++] = compressed;
+    *size = compressedSize;
+    return compressed;
+}
+
+/**
+ * This function posts the sends of a serialized buffer, which starts with a count and so is never mistaken for a 
+ * compressed buffer by the receiver. When the buffer is compressed, it is freed at once and the compressed one 
+ * is sent, otherwise it is sent as it is. In both cases the buffer is owned by the pending sends, and freed by 
+ * chunkedSendWait().
+ * 
+ * @param pending The pending sends
+ * @param buffer The serialized buffer
+ * @param size The number of integers of the buffer
+ * @param dest The rank of the receiver
+ * @param tag The tag of the stream
+ * @param comm The communicator
+*/
+void chunkedSendPayload(TChunkedSend* pending, int* buffer, int size, int dest, int tag, MPI_Comm comm) {
+
+    int* compressed = chunkedSendCompress(pending, buffer, &size);
+    if(compressed != NULL) {
+        free(buffer);
+        buffer = compressed;
+    } else {
+        assert(pending->ownedCount < COMM_STREAMS);
+        pending->owned[pending->ownedCount++] = buffer;
+    }
+
+    chunkedSend(pending, buffer, size, dest, tag, comm);
+}
+
+/**
+ * This function posts the sends of a graph without serializing it. The number of vertices, ghosts and edges is sent 
+ * first as the stream COMM_TAG_GRAPH, then the ids, offsets and targets arrays are sent as three streams directly 
+ * from the storage of the graph, which must not be destroyed until chunkedSendWait() returns. Since the targets 
+ * are positions in the ids array of the graph, the receiver can use the arrays as they are. The large arrays are 
+ * sent compressed instead: the fourth integer of the header has the bit i set if the i-th array is compressed, 
+ * so that the receiver knows which ones it can receive in place.
+ * 
+ * @param pending The pending sends
+ * @param graph The graph to send
+ * @param dest The rank of the receiver
+ * @param comm The communicator
+*/
+void chunkedSendGraph(TChunkedSend* pending, TGraph graph, int dest, MPI_Comm comm) {
+
+    int* arrays[3] = { graph->ids, graph->offsets, graph->targets };
+    int sizes[3] = { graph->vertices + graph->ghosts, graph->vertices + 1, graph->edges };
+
+    pending->header[0] = graph->vertices;
+    pending->header[1] = graph->ghosts;
+    pending->header[2] = graph->edges;
+    pending->header[3] = 0;
+
+    for(int a = 0; a < 3; a++) {
+        int* compressed = chunkedSendCompress(pending, arrays[a], &sizes[a]);
+        if(compressed != NULL) {
+            arrays[a] = compressed;
+            pending->header[3] |= 1 << a;
+        }
+    }
+
+    chunkedSend(pending, pending->header, 4, dest, COMM_TAG_GRAPH, comm);
+    for(int a = 0; a < 3; a++)
+        chunkedSend(pending, arrays[a], sizes[a], dest, COMM_TAG_GRAPH_IDS + a, comm);
+}
+
+/**
+ * This function waits for the completion of all the pending sends and releases their requests and the buffers 
+ * they own.
+ * 
+ * @param pending The pending sends
+*/
+void chunkedSendWait(TChunkedSend* pending) {
+
+    MPI_Waitall(pending->count, pending->requests, MPI_STATUSES_IGNORE);
+    free(pending->requests);
+    for(int b = 0; b < pending->ownedCount; b++)
+        free(pending->owned[b]);
+    *pending = chunkedSendCreate();
+}
+
+/**
+ * This function posts the receive of the next chunk of a stream directly at the end of its buffer. When the 
+ * size of the stream is known, the receive is limited to the integers still missing, which are exactly the 
+ * ones of the next chunk sent. Otherwise the buffer is grown geometrically so that it can hold a full chunk: 
+ * since a stream only has one receive posted at a time, the buffer can be moved by realloc between two chunks.
+ * 
+ * @param stream The stream
+ * @param request The request of the receive
+*/
+static void chunkedRecvPost(TChunkedRecv* stream, MPI_Request* request) {
+
+    if(stream->fixed) {
+        MPI_Irecv(stream->buffer + stream->size, min(COMM_CHUNK_SIZE, stream->capacity - stream->size), MPI_INT, 
+            stream->source, stream->tag, stream->comm, request);
+        return;
+    }
+
+    if(stream->size + COMM_CHUNK_SIZE > stream->capacity) {
+        stream->capacity = 2 * stream->capacity > stream->size + COMM_CHUNK_SIZE ? 2 * stream->capacity : stream->size + COMM_CHUNK_SIZE;
+        stream->buffer = (int*)realloc(stream->buffer, stream->capacity * sizeof(int));
+        assert(stream->buffer != NULL);
+    }
+
+    MPI_Irecv(stream->buffer + stream->size, COMM_CHUNK_SIZE, MPI_INT, stream->source, stream->tag, stream->comm, request);
+}
+
+/**
+ * This function initializes a stream and posts the receive of its first chunk. Chunks with the same source 
+ * and tag are matched in the order they were sent, so the stream is rebuilt in order.
+ * 
+ * @param stream The stream
+ * @param request The request of the receive
+ * @param source The rank of the sender
+ * @param tag The tag of the stream
+ * @param comm The communicator
+*/
+void chunkedRecvStart(TChunkedRecv* stream, MPI_Request* request, int source, int tag, MPI_Comm comm) {
+
+    stream->buffer = NULL;
+    stream->size = 0;
+    stream->capacity = 0;
+    stream->fixed = false;
+    stream->target = NULL;
+    stream->source = source;
+    stream->tag = tag;
+    stream->comm = comm;
+
+    chunkedRecvPost(stream, request);
+}
+
+/**
+ * This function creates the graph announced by a completed COMM_TAG_GRAPH stream and posts the receives of the 
+ * streams of its ids, offsets and targets arrays, whose sizes are now known, directly into the arrays of the new 
+ * graph, so that no copy is needed once they are complete. The arrays sent compressed are instead received in 
+ * streams of their own, which are decompressed into the arrays of the graph when they are complete. The buffer 
+ * of the header is freed.
+ * 
+ * @param streams The streams of the sender, indexed by their tag
+ * @param requests The requests of the streams of the sender, indexed by their tag
+ * @return The graph, whose arrays are valid once the three streams are complete
+*/
+TGraph chunkedRecvGraph(TChunkedRecv* streams, MPI_Request* requests) {
+
+    TChunkedRecv* header = &streams[COMM_TAG_GRAPH];
+    assert(header->size == 4);
+
+    TGraph graph = graphCreate(header->buffer[0], header->buffer[2]);
+    graph->ghosts = header->buffer[1];
+    graph->ids = (int*)realloc(graph->ids, (graph->vertices + graph->ghosts + 1) * sizeof(int));
+    assert(graph->ids != NULL);
+
+    int* arrays[3] = { graph->ids, graph->offsets, graph->targets };
+    int sizes[3] = { graph->vertices + graph->ghosts, graph->vertices + 1, graph->edges };
+
+    for(int a = 0; a < 3; a++) {
+        TChunkedRecv* stream = &streams[COMM_TAG_GRAPH_IDS + a];
+        if(header->buffer[3] & (1 << a)) {
+            chunkedRecvStart(stream, &requests[COMM_TAG_GRAPH_IDS + a], header->source, COMM_TAG_GRAPH_IDS + a, header->comm);
+            stream->target = arrays[a];
+            continue;
+        }
+        stream->buffer = arrays[a];
+        stream->size = 0;
+        stream->capacity = sizes[a];
+        stream->fixed = true;
+        stream->target = NULL;
+        stream->source = header->source;
+        stream->tag = COMM_TAG_GRAPH_IDS + a;
+        stream->comm = header->comm;
+        chunkedRecvPost(stream, &requests[COMM_TAG_GRAPH_IDS + a]);
+    }
+
+    free(header->buffer);
+    header->buffer = NULL;
+
+    return graph;
+}
+
+/**
+ * This function waits with MPI_Waitany for the next chunk of any of the streams. The length of the chunk is read 
+ * from its status with MPI_Get_count: a full chunk means that the stream goes on, so the receive of the next 
+ * chunk is posted at once, while a shorter one completes the stream, whose index is returned. The request of 
+ * a complete stream is left to MPI_REQUEST_NULL, so the function can be called again to wait for the other 
+ * streams, and the caller can deserialize a stream while the chunks of the other ones are still arriving. A 
+ * complete stream that is compressed is decompressed before being returned, into its target array if it has 
+ * one, or else into a new buffer which replaces the received one.
+ * 
+ * @param streams The streams
+ * @param requests The requests of the streams
+ * @param count The number of streams
+ * @return The index of the stream completed, or MPI_UNDEFINED if all the streams were already complete
+*/
+int chunkedRecvWaitAny(TChunkedRecv* streams, MPI_Request* requests, int count) {
+
+    while(true) {
+        int index, 
+            received;
+        MPI_Status status;
+
+        MPI_Waitany(count, requests, &index, &status);
+        if(index == MPI_UNDEFINED)
+            return MPI_UNDEFINED;
+
+        MPI_Get_count(&status, MPI_INT, &received);
+        streams[index].size += received;
+
+        if(received < COMM_CHUNK_SIZE) {
+            TChunkedRecv* stream = &streams[index];
+            if(!stream->fixed && isCompressed(stream->buffer, stream->size)) {
+                int length = compressedLength(stream->buffer);
+                int* values = stream->target;
+                if(values == NULL) {
+                    values = (int*)malloc((length + 1) * sizeof(int));
+                    assert(values != NULL);
+                }
+                decompressInts(stream->buffer, values);
+                free(stream->buffer);
+                stream->buffer = values;
+                stream->size = length;
+                stream->capacity = length;
+            }
+            return index;
+        }
+
+        chunkedRecvPost(&streams[index], &requests[index]);
+    }
+}
+
+/**
+ * This function groups the processes of a communicator by node with MPI_Comm_split_type, and translates the 
+ * ranks of the communicator into the ones of the node communicator, so that every process knows which processes 
+ * it can reach through shared memory. When COMM_SHARED_MEMORY is 0 every process forms a node of its own, and 
+ * all the payloads go through messages.
+ * 
+ * @param comm The communicator of the merge round
+ * @return The shared memory of the round, without a window yet
+*/
+TSharedSegment sharedSegmentCreate(MPI_Comm comm) {
+
+    TSharedSegment shared;
+    int rank,
+        size;
+    MPI_Group group,
+              nodeGroup;
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    #if COMM_SHARED_MEMORY
+        MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &shared.node);
+    #else
+        MPI_Comm_split(comm, rank, 0, &shared.node);
+    #endif
+
+    int* ranks = (int*)malloc((size + 1) * sizeof(int));
+    shared.nodeRanks = (int*)malloc((size + 1) * sizeof(int));
+    assert(ranks != NULL && shared.nodeRanks != NULL);
+    for(int r = 0; r < size; r++)
+        ranks[r] = r;
+
+    MPI_Comm_group(comm, &group);
+    MPI_Comm_group(shared.node, &nodeGroup);
+    MPI_Group_translate_ranks(group, size, ranks, nodeGroup, shared.nodeRanks);
+    MPI_Group_free(&group);
+    MPI_Group_free(&nodeGroup);
+    free(ranks);
+
+    shared.window = MPI_WIN_NULL;
+    shared.segment = NULL;
+
+    return shared;
+}
+
+/**
+ * This function checks if a process of the round communicator runs on the same node as the calling one.
+ * 
+ * @param shared The shared memory of the round
+ * @param rank The rank of the process in the round communicator
+ * @return true if the process is on the same node, false otherwise
+*/
+bool sharedSegmentIsLocal(TSharedSegment* shared, int rank) {
+
+    return shared->nodeRanks[rank] != MPI_UNDEFINED;
+}
+
+/**
+ * This function allocates, with MPI_Win_allocate_shared, the segment of every process of the node, which is 
+ * collective over the node. A process that sends its payloads through shared memory passes its graph and its 
+ * two serialized hash tables, which are copied into its segment after a header of COMM_SHARED_HEADER integers 
+ * with their sizes, while the other processes pass a NULL graph and get an empty segment. The segments are 
+ * allocated with the 'alloc_shared_noncontig' hint, so that each one can be placed in the memory closest to its 
+ * owner. The window is then locked for the whole round, and after a memory barrier and a barrier over the node 
+ * all the segments can be read by the other processes of the node.
+ * 
+ * @param shared The shared memory of the round
+ * @param graph The graph to publish, or NULL
+ * @param sccs The serialized hash table of the macronodes
+ * @param sccsSize The number of integers of the hash table of the macronodes
+ * @param aux The serialized hash table of the auxiliary graph
+ * @param auxSize The number of integers of the hash table of the auxiliary graph
+*/
+void sharedSegmentPublish(TSharedSegment* shared, TGraph graph, int* sccs, int sccsSize, int* aux, int auxSize) {
+
+    MPI_Aint size = 0;
+    MPI_Info info;
+
+    if(graph != NULL)
+        size = ((MPI_Aint) COMM_SHARED_HEADER + 2 * (MPI_Aint) graph->vertices + graph->ghosts + 1 + graph->edges + sccsSize + auxSize) * sizeof(int);
+
+    MPI_Info_create(&info);
+    MPI_Info_set(info, "alloc_shared_noncontig", "true");
+    MPI_Win_allocate_shared(size, sizeof(int), info, shared->node, &shared->segment, &shared->window);
+    MPI_Info_free(&info);
+
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, shared->window);
+
+    if(graph != NULL) {
+        int* segment = shared->segment;
+        segment[0] = graph->vertices;
+        segment[1] = graph->ghosts;
+        segment[2] = graph->edges;
+        segment[3] = sccsSize;
+        segment[4] = auxSize;
+        segment += COMM_SHARED_HEADER;
+
+        memcpy(segment, graph->ids, (graph->vertices + graph->ghosts) * sizeof(int));
+        segment += graph->vertices + graph->ghosts;
+        memcpy(segment, graph->offsets, (graph->vertices + 1) * sizeof(int));
+        segment += graph->vertices + 1;
+        memcpy(segment, graph->targets, graph->edges * sizeof(int));
+        segment += graph->edges;
+        memcpy(segment, sccs, sccsSize * sizeof(int));
+        segment += sccsSize;
+        memcpy(segment, aux, auxSize * sizeof(int));
+    }
+
+    MPI_Win_sync(shared->window);
+    MPI_Barrier(shared->node);
+    MPI_Win_sync(shared->window);
+}
+
+/**
+ * This function returns the graph published by a process of the same node. The segment of the process is located 
+ * with MPI_Win_shared_query, and the arrays of the graph point directly into it, so nothing is copied: the graph 
+ * must only be read, and must be released by freeing the graph alone, not its arrays, before the window is freed. 
+ * The two serialized hash tables are returned the same way.
+ * 
+ * @param shared The shared memory of the round
+ * @param rank The rank of the process in the round communicator
+ * @param sccs A pointer where the address of the serialized hash table of the macronodes is stored
+ * @param aux A pointer where the address of the serialized hash table of the auxiliary graph is stored
+ * @return The graph of the process
+*/
+TGraph sharedSegmentGraph(TSharedSegment* shared, int rank, int** sccs, int** aux) {
+
+    MPI_Aint size;
+    int unit;
+    int* segment;
+
+    MPI_Win_shared_query(shared->window, shared->nodeRanks[rank], &size, &unit, &segment);
+    assert(size >= (MPI_Aint)(COMM_SHARED_HEADER * sizeof(int)));
+
+    TGraph graph = (TGraph)malloc(sizeof(TGraphNode));
+    assert(graph != NULL);
+    graph->vertices = segment[0];
+    graph->ghosts = segment[1];
+    graph->edges = segment[2];
+    graph->mapping = NULL;
+    graph->mappingSize = 0;
+
+    int* position = segment + COMM_SHARED_HEADER;
+    graph->ids = position;
+    position += graph->vertices + graph->ghosts;
+    graph->offsets = position;
+    position += graph->vertices + 1;
+    graph->targets = position;
+    position += graph->edges;
+    *sccs = position;
+    position += segment[3];
+    *aux = position;
+
+    return graph;
+}
+
+/**
+ * This function unlocks and frees the window, which is collective over the node, so a process waits here until 
+ * all the processes of its node are done with the segments, and then frees the node communicator.
+ * 
+ * @param shared The shared memory of the round
+*/
+void sharedSegmentDestroy(TSharedSegment* shared) {
+
+    MPI_Win_unlock_all(shared->window);
+    MPI_Win_free(&shared->window);
+    MPI_Comm_free(&shared->node);
+    free(shared->nodeRanks);
+    shared->segment = NULL;
+    shared->nodeRanks = NULL;
+}
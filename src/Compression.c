@@ -0,0 +1,240 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file Compression.c
+ * 
+ * @brief Source file for the compressed encoding of the arrays of integers. A compressed buffer is an 
+ * array of integers laid out as follows: 
+ *  - COMPRESSION_MARKER; 
+ *  - the number of values n; 
+ *  - the number of blocks b = ceil(n / COMPRESSION_BLOCK); 
+ *  - b + 1 byte offsets, where the block i is stored between the offsets i and i + 1; 
+ *  - the bytes of the blocks, padded to a multiple of the size of an integer. 
+ * Since the offsets of all the blocks are known, both the encoding and the decoding of the blocks are done 
+ * in parallel.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include <omp.h>
+
+#include "../include/Compression.h"
+
+/**
+ * The largest number of bytes of a value encoded as a variable-length integer: 32 bits in groups of 7.
+ */
+#define COMPRESSION_MAX_BYTES 5
+
+/**
+ * The number of integers of the header of a compressed buffer before the byte offsets.
+ */
+#define COMPRESSION_HEADER 3
+
+/**
+ * This function encodes a block of values: every value is stored as the difference from the previous one 
+ * (the first one from 0), computed on unsigned integers so that it wraps around instead of overflowing, 
+ * then zigzag encoded so that small negative differences become small positive values, and finally written 
+ * 7 bits at a time, with the highest bit of a byte set when more bytes follow.
+ * 
+ * @param values The values of the block
+ * @param count The number of values of the block
+ * @param out The buffer where the bytes are written, of at least COMPRESSION_MAX_BYTES * count bytes
+ * @return The number of bytes written
+*/
+static int compressBlock(const int* values, int count, uint8_t* out) {
+
+    uint32_t previous = 0;
+    int length = 0;
+
+    for(int i = 0; i < count; i++) {
+        uint32_t delta = (uint32_t)values[i] - previous;
+        uint32_t zigzag = (delta << 1) ^ (uint32_t)((int32_t)delta >> 31);
+        previous = (uint32_t)values[i];
+
+        while(zigzag >= 0x80) {
+            out[length++] = (uint8_t)(zigzag | 0x80);
+            zigzag >>= 7;
+        }
+        out[length++] = (uint8_t)zigzag;
+    }
+
+    return length;
+}
+
+/**
+ * This function decodes a block of values encoded by compressBlock().
+ * 
+ * @param in The bytes of the block
+ * @param count The number of values of the block
+ * @param values The array where the values are written
+*/
+static void decompressBlock(const uint8_t* in, int count, int* values) {
+
+    uint32_t previous = 0;
+    int position = 0;
+
+    for(int i = 0; i < count; i++) {
+        uint32_t zigzag = 0;
+        int shift = 0;
+        uint8_t byte;
+
+        do {
+            byte = in[position++];
+            zigzag |= (uint32_t)(byte & 0x7F) << shift;
+            shift += 7;
+        } while(byte & 0x80);
+
+        previous += (zigzag >> 1) ^ (0u - (zigzag & 1));
+        values[i] = (int)previous;
+    }
+}
+
+/**
+ * This function compresses an array of integers. The blocks are first encoded in parallel into a scratch buffer 
+ * with room for the worst case of every block, then the byte offsets of the blocks are computed with a prefix 
+ * sum over their lengths, and the blocks are copied, again in parallel, to their place in the compressed buffer. 
+ * If the compressed buffer is not smaller than the array, for example because the values are random, the work 
+ * is thrown away and the array should be used as it is.
+ * 
+ * @param values The array to compress
+ * @param count The number of values of the array
+ * @param size A pointer to an integer where the number of integers of the compressed buffer is stored
+ * @return The compressed buffer, or NULL if it would not be smaller than the array
+*/
+int* compressInts(const int* values, int count, int* size) {
+
+    int blocks = (count + COMPRESSION_BLOCK - 1) / COMPRESSION_BLOCK;
+    uint8_t* scratch = (uint8_t*)malloc((size_t)count * COMPRESSION_MAX_BYTES + 1);
+    long long* offsets = (long long*)malloc((blocks + 1) * sizeof(long long));
+    assert(scratch != NULL && offsets != NULL);
+
+    #pragma omp parallel for schedule(dynamic, 1)
+    for(int b = 0; b < blocks; b++) {
+        int first = b * COMPRESSION_BLOCK;
+        int length = count - first < COMPRESSION_BLOCK ? count - first : COMPRESSION_BLOCK;
+        offsets[b + 1] = compressBlock(values + first, length, scratch + (size_t)first * COMPRESSION_MAX_BYTES);
+    }
+
+    offsets[0] = 0;
+    for(int b = 0; b < blocks; b++)
+        offsets[b + 1] += offsets[b];
+
+    long long header = COMPRESSION_HEADER + blocks + 1;
+    long long total = header + (offsets[blocks] + sizeof(int) - 1) / sizeof(int);
+
+    if(total >= count) {
+        free(scratch);
+        free(offsets);
+        return NULL;
+    }
+
+    int* buf = (int*)malloc(total * sizeof(int));
+    assert(buf != NULL);
+    buf[0] = COMPRESSION_MARKER;
+    buf[1] = count;
+    buf[2] = blocks;
+    for(int b = 0; b <= blocks; b++)
+        buf[COMPRESSION_HEADER + b] = (int)offsets[b];
+    buf[total - 1] = 0;
+
+    uint8_t* bytes = (uint8_t*)(buf + header);
+
+    #pragma omp parallel for schedule(dynamic, 1)
+    for(int b = 0; b < blocks; b++)
+        memcpy(bytes + offsets[b], scratch + (size_t)b * COMPRESSION_BLOCK * COMPRESSION_MAX_BYTES, offsets[b + 1] - offsets[b]);
+
+    free(scratch);
+    free(offsets);
+
+    *size = (int)total;
+    return buf;
+}
+
+/**
+ * This function returns the number of values stored in a compressed buffer, which is the size of the array 
+ * needed by decompressInts().
+ * 
+ * @param buf The compressed buffer
+ * @return The number of values
+*/
+int compressedLength(const int* buf) {
+
+    return buf[1];
+}
+
+/**
+ * This function decompresses a compressed buffer, decoding its blocks in parallel.
+ * 
+ * @param buf The compressed buffer
+ * @param values The array where the values are written, of at least compressedLength(buf) integers
+*/
+void decompressInts(const int* buf, int* values) {
+
+    int count = buf[1],
+        blocks = buf[2];
+    const int* offsets = buf + COMPRESSION_HEADER;
+    const uint8_t* bytes = (const uint8_t*)(buf + COMPRESSION_HEADER + blocks + 1);
+
+    #pragma omp parallel for schedule(dynamic, 1)
+    for(int b = 0; b < blocks; b++) {
+        int first = b * COMPRESSION_BLOCK;
+        int length = count - first < COMPRESSION_BLOCK ? count - first : COMPRESSION_BLOCK;
+        decompressBlock(bytes + offsets[b], length, values + first);
+    }
+}
+
+/**
+ * This function checks if a buffer is a compressed buffer, by its first integer.
+ * 
+ * @param buf The buffer
+ * @param size The number of integers of the buffer
+ * @return true if the buffer is compressed, false otherwise
+*/
+bool isCompressed(const int* buf, int size) {
+
+    return size >= COMPRESSION_HEADER && buf[0] == COMPRESSION_MARKER;
+}
@@ -0,0 +1,80 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file ConvertGraph.c
+ * 
+ * @brief This is a C file containing a program which converts a graph from the text format produced 
+ * by the generator to the binary format, which the algorithms load with a memory mapping instead of 
+ * parsing it.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../include/TGraph.h"
+
+/** 
+ * The program takes in two command-line arguments: the name of the graph file in text format and the 
+ * name of the graph file in binary format to be written. If the number of command-line arguments is not 
+ * two, it prints a usage message and exits with an error code. Otherwise, it loads the graph with the 
+ * popolateGraph function, which also sorts the vertices and replaces the identifiers of the neighbors 
+ * with their positions, and writes the resulting CSR arrays with the graphSaveBinary function. It then 
+ * exits with a success code.
+ */
+int main(int argc, char** argv) {
+
+  if(argc != 3){
+    fprintf(stderr,"Usage:\n\t%s [textFileName] [binaryFileName]\n", argv[0]);
+    exit(EXIT_FAILURE);
+  }
+
+  TGraph graph = popolateGraph(argv[1]);
+
+  graphSaveBinary(graph, argv[2]);
+  graphDestroy(graph);
+
+  exit(EXIT_SUCCESS);
+
+}
@@ -58,23 +58,22 @@
 /**
  * @brief Prints the strongly connected components (SCCs) of a graph to the console.
  *
- * @param sccCount An integer representing the total number of SCCs in the graph.
- * @param sccs An array of TArray structures, where each TArray represents an SCC and contains the 
- * indices of the vertices that belong to that SCC.
+ * @param sccs A pointer to the set of the SCCs, where the vertices of every SCC are stored contiguously 
+ * between two offsets.
  * @param numOriginalVertices An integer representing the total number of vertices in the original 
  * graph.
  * @param sccsHT A hash table (THTSCCs) used to store the SCCs in a more efficient manner.
  */
-void printSCCs(int sccCount, TArray* sccs, int numOriginalVertices, THTSCCs* sccsHT){
+void printSCCs(TSCCs* sccs, int numOriginalVertices, THTSCCs* sccsHT){
 
-    printf("\nSCCs totali: %d\n", sccCount);
+    printf("\nSCCs totali: %d\n", sccs->count);
 
-    for(int i = 0; i < sccCount; i++) {
+    for(int i = 0; i < sccs->count; i++) {
 
         printf("SCC %d: ", i + 1);
 
-        for(int j = 0; j < sccs[i].length; j++) {
-            printNode(sccsHT, sccs[i].items[j], numOriginalVertices, NULL);
+        for(int j = sccs->offsets[i]; j < sccs->offsets[i + 1]; j++) {
+            printNode(sccsHT, sccs->vertices[j], numOriginalVertices, NULL);
         }
             
         printf("\n");
@@ -86,14 +85,13 @@ void printSCCs(int sccCount, TArray* sccs, int numOriginalVertices, THTSCCs* scc
 /**
  * @brief Writes the strongly connected components (SCCs) of a graph to a specified file.
  *
- * @param sccCount An integer representing the total number of SCCs in the graph.
- * @param sccs An array of TArray structures, where each TArray represents an SCC and contains the 
- * indices of the vertices that belong to that SCC.
+ * @param sccs A pointer to the set of the SCCs, where the vertices of every SCC are stored contiguously 
+ * between two offsets.
  * @param numOriginalVertices An integer representing the total number of vertices in the original graph.
  * @param sccsHT A hash table (THTSCCs) used to store the SCCs in a more efficient manner.
  * @param fileName A string representing the name of the file to which the SCCs should be written.
  */
-void printSCCsOnFile(int sccCount, TArray* sccs, int numOriginalVertices, THTSCCs* sccsHT, char* fileName){
+void printSCCsOnFile(TSCCs* sccs, int numOriginalVertices, THTSCCs* sccsHT, char* fileName){
 
     FILE *fd;
 
@@ -103,12 +101,12 @@ void printSCCsOnFile(int sccCount, TArray* sccs, int numOriginalVertices, THTSCC
         exit(1);
     }
 
-    if(fprintf(fd, "%d\n", sccCount) == 1);
+    if(fprintf(fd, "%d\n", sccs->count) == 1);
 
-    for(int i = 0; i < sccCount; i++) {
+    for(int i = 0; i < sccs->count; i++) {
 
-        for(int j = 0; j < sccs[i].length; j++) {
-            printNode(sccsHT, sccs[i].items[j], numOriginalVertices, fd);
+        for(int j = sccs->offsets[i]; j < sccs->offsets[i + 1]; j++) {
+            printNode(sccsHT, sccs->vertices[j], numOriginalVertices, fd);
         }
             
         if(fprintf(fd, "-1\n") == 1); 
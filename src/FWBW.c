@@ -0,0 +1,298 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file FWBW.c
+ * 
+ * @brief Source file for the Forward-Backward (FW-BW) algorithm to find the strongly connected 
+ * components (SCCs) of a directed graph. The algorithm takes in a TGraph (a graph data structure), 
+ * start and stop indices, and returns the SCCs found in a TSCCs set, like the other algorithms. Given a set of vertices, the algorithm picks a pivot and computes the set of vertices 
+ * reachable from it (forward set) and the set of vertices that reach it (backward set): their 
+ * intersection is the SCC of the pivot, while every other SCC is entirely contained in the forward 
+ * set, in the backward set or in the remaining vertices, so these three sets are solved independently 
+ * as OpenMP tasks. The subproblems are told apart by giving a different color to their vertices.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <omp.h>
+
+#include "../include/FWBW.h"
+#include "../include/Kosaraju.h"
+
+/**
+ * This function expands a vertex of the frontier of the breadth-first search. A neighbor of the vertex is 
+ * reached if it is in the cut and its color is from, in which case it is recolored to to, or is alsoFrom, in 
+ * which case it is recolored to alsoTo. The recoloring is performed with an atomic compare-and-swap and the 
+ * slot of the queue is reserved with an atomic fetch-and-add, so the function can be called concurrently and 
+ * every vertex is appended to the queue by only one thread.
+ * 
+ * @param context A pointer to the state of the algorithm
+ * @param graph The graph to be searched, that is the graph or its transpose
+ * @param u The position of the vertex to be expanded
+ * @param queue The queue of the breadth-first search
+ * @param tail A pointer to the number of vertices in the queue
+ * @param from The color of the vertices to be reached
+ * @param to The color given to the reached vertices of color from
+ * @param alsoFrom Another color of the vertices to be reached, or -1
+ * @param alsoTo The color given to the reached vertices of color alsoFrom
+*/
+static void fwbwExpand(TFWBWContext *context, TGraph graph, int u, int *queue, int *tail, int from, int to, int alsoFrom, int alsoTo) {
+
+    for(int j = graph->offsets[u]; j < graph->offsets[u + 1]; j++) {
+        int v = graph->targets[j];
+        if(!isInCut(v, context->start, context->stop))
+            continue;
+        int *c = &context->color[v - context->start];
+        if((*c == from && __sync_bool_compare_and_swap(c, from, to)) || 
+           (*c == alsoFrom && __sync_bool_compare_and_swap(c, alsoFrom, alsoTo)))
+            queue[__sync_fetch_and_add(tail, 1)] = v;
+    }
+}
+
+/**
+ * This function computes the vertices reachable from a pivot with a level-synchronous breadth-first search. 
+ * The pivot must already have been recolored by the caller. The queue holds the vertices reached so far: the 
+ * vertices between head and the end of the current level form the frontier, and the vertices of the next level 
+ * are appended after them. When the frontier has more than FWBW_FRONTIER_CUTOFF vertices it is expanded in 
+ * parallel by a taskloop, otherwise it is expanded by the calling task.
+ * 
+ * @param context A pointer to the state of the algorithm
+ * @param graph The graph to be searched, that is the graph or its transpose
+ * @param queue A buffer large enough to hold all the vertices of the subproblem
+ * @param pivot The position of the vertex from which the search starts
+ * @param from The color of the vertices to be reached
+ * @param to The color given to the reached vertices of color from
+ * @param alsoFrom Another color of the vertices to be reached, or -1
+ * @param alsoTo The color given to the reached vertices of color alsoFrom
+ * @return The number of vertices reached, pivot included
+*/
+int fwbwReach(TFWBWContext *context, TGraph graph, int *queue, int pivot, int from, int to, int alsoFrom, int alsoTo) {
+
+    int head = 0, tail = 0;
+
+    queue[tail++] = pivot;
+
+    while(head < tail) {
+        int level = tail;
+
+        if(level - head > FWBW_FRONTIER_CUTOFF) {
+            #pragma omp taskloop grainsize(FWBW_FRONTIER_CUTOFF / 4) shared(tail)
+            for(int i = head; i < level; i++)
+                fwbwExpand(context, graph, queue[i], queue, &tail, from, to, alsoFrom, alsoTo);
+        } else {
+            for(int i = head; i < level; i++)
+                fwbwExpand(context, graph, queue[i], queue, &tail, from, to, alsoFrom, alsoTo);
+        }
+
+        head = level;
+    }
+
+    return tail;
+}
+
+/**
+ * This function appends a new SCC to the set of SCCs, reserving its room with sccsAppendShared(), since 
+ * the tasks emit their SCCs concurrently, and fills it with the identifiers of the given vertices.
+ * 
+ * @param context A pointer to the state of the algorithm
+ * @param vertices The positions of the vertices of the SCC
+ * @param length The number of vertices of the SCC
+*/
+static void fwbwEmit(TFWBWContext *context, int *vertices, int length) {
+
+    int *members = sccsAppendShared(&context->sccs, length);
+    for(int i = 0; i < length; i++)
+        members[i] = context->graph->ids[vertices[i]];
+}
+
+/**
+ * This function solves a subproblem of the FW-BW algorithm. A subproblem with a single vertex is an SCC 
+ * on its own. Otherwise, the vertex in the middle of the list is chosen as pivot, three new colors are 
+ * reserved for the forward set, the backward set and the SCC of the pivot, and the function:
+ * 
+ *  1. computes the forward set on the graph, recoloring the vertices of the subproblem from its color to 
+ *     the forward color;
+ *  2. computes the backward set on the transpose, recoloring the vertices still of the color of the 
+ *     subproblem to the backward color and the vertices of the forward color to the SCC color;
+ *  3. scans the list of the vertices of the subproblem and splits it by color: the vertices of the SCC 
+ *     color are emitted as an SCC, while the forward set, the backward set and the remaining vertices, 
+ *     which keep the color of the subproblem, become three new subproblems;
+ *  4. spawns a task for every new subproblem, unless it is smaller than FWBW_TASK_CUTOFF, in which case 
+ *     it is solved immediately by the current task.
+ * 
+ * The list of the vertices of the subproblem is owned, and freed, by this function.
+ * 
+ * @param context A pointer to the state of the algorithm
+ * @param vertices The positions of the vertices of the subproblem
+ * @param length The number of vertices of the subproblem
+ * @param color The color of the vertices of the subproblem
+*/
+void fwbwSolve(TFWBWContext *context, int *vertices, int length, int color) {
+
+    if(length <= 1) {
+        if(length == 1) {
+            context->color[vertices[0] - context->start] = FWBW_DONE;
+            fwbwEmit(context, vertices, 1);
+        }
+        free(vertices);
+        return;
+    }
+
+    int pivot = vertices[length / 2];
+    int forward = __sync_fetch_and_add(&context->nextColor, 3);
+    int backward = forward + 1, component = forward + 2;
+    int *queue = (int *) malloc(length * sizeof(int));
+    assert(queue != NULL);
+
+    context->color[pivot - context->start] = forward;
+    fwbwReach(context, context->graph, queue, pivot, color, forward, -1, -1);
+    context->color[pivot - context->start] = component;
+    fwbwReach(context, context->transpose, queue, pivot, color, backward, forward, component);
+
+    int counts[3] = {0, 0, 0}, sccLength = 0;
+    for(int i = 0; i < length; i++) {
+        int c = context->color[vertices[i] - context->start];
+        if(c == component) sccLength++;
+        else if(c == forward) counts[0]++;
+        else if(c == backward) counts[1]++;
+        else counts[2]++;
+    }
+
+    int *lists[3];
+    for(int k = 0; k < 3; k++) {
+        lists[k] = (int *) malloc((counts[k] > 0 ? counts[k] : 1) * sizeof(int));
+        assert(lists[k] != NULL);
+        counts[k] = 0;
+    }
+
+    int *scc = queue;
+    sccLength = 0;
+    for(int i = 0; i < length; i++) {
+        int v = vertices[i];
+        int *c = &context->color[v - context->start];
+        if(*c == component) {
+            *c = FWBW_DONE;
+            scc[sccLength++] = v;
+        } 
+        else if(*c == forward) lists[0][counts[0]++] = v;
+        else if(*c == backward) lists[1][counts[1]++] = v;
+        else lists[2][counts[2]++] = v;
+    }
+
+    fwbwEmit(context, scc, sccLength);
+    free(queue);
+    free(vertices);
+
+    int colors[3] = {forward, backward, color};
+    for(int k = 0; k < 3; k++) {
+        int *list = lists[k], size = counts[k], subColor = colors[k];
+        #pragma omp task if(size > FWBW_TASK_CUTOFF) firstprivate(list, size, subColor)
+        fwbwSolve(context, list, size, subColor);
+    }
+}
+
+/**
+ * This function is an implementation of the Forward-Backward algorithm to find the strongly connected 
+ * components (SCCs) in a given range of vertices of a graph.
+ * 
+ *  1.The function starts by creating the transpose of the graph restricted to the cut, by calling the 
+ *    "transposeGraph" function.
+ *  2.Then, it creates a set, called "sccs", to store the SCCs that are found, and the color array, both with 
+ *    room for every vertex of the cut.
+ *  3.It runs the trimming pre-pass ("trimGraph"), which records the trivial SCCs of the cut. Their vertices get 
+ *    the color FWBW_DONE, and the list of the other vertices of the cut is the first subproblem.
+ *  4.It opens an OpenMP parallel region in which a single thread solves the first subproblem by calling the 
+ *    "fwbwSolve" function, while the other threads execute the tasks it creates. The implicit barrier at the 
+ *    end of the region waits for all the tasks.
+ *  5.Finally, it frees the memory allocated for the color array and the transposed graph, and returns the 
+ *    set of SCCs.
+ * 
+ * @param graph The graph on which to perform the FW-BW algorithm
+ * @param start The lower bound of the range in which to search for SCCs
+ * @param stop The upper bound of the range in which to search for SCCs
+ * @return The set of SCCs
+ */
+TSCCs fwbw(TGraph graph, int start, int stop) {
+
+    int dim = stop - start;
+    TFWBWContext context;
+
+    context.graph = graph;
+    context.transpose = transposeGraph(&graph, start, stop);
+    context.start = start;
+    context.stop = stop;
+    context.color = (int *) malloc((dim > 0 ? dim : 1) * sizeof(int));
+    context.nextColor = 2;
+    context.sccs = sccsCreate(dim);
+
+    uint64_t *trimmed = (uint64_t *) calloc(BITSET_WORDS(dim) + 1, sizeof(uint64_t));
+    int *vertices = (int *) malloc((dim > 0 ? dim : 1) * sizeof(int));
+    assert(context.color != NULL && trimmed != NULL && vertices != NULL);
+    int length = 0;
+
+    trimGraph(graph, start, stop, trimmed, &context.sccs);
+
+    for(int i = 0; i < dim; i++) {
+        if(BITSET_TEST(trimmed, i))
+            context.color[i] = FWBW_DONE;
+        else {
+            context.color[i] = 1;
+            vertices[length++] = start + i;
+        }
+    }
+
+    free(trimmed);
+
+    #pragma omp parallel
+    #pragma omp single
+    fwbwSolve(&context, vertices, length, 1);
+
+    free(context.color);
+    graphDestroy(context.transpose);
+
+    return context.sccs;
+}
@@ -41,14 +41,13 @@
  * @file Kosaraju.c
  * 
  * @brief Source file for the Kosaraju's algorithm to find the strongly connected components 
- * (SCCs) of a directed graph. The algorithm takes in a TGraph (a graph data structure), start 
- * and stop indices, and a pointer to an integer for the number of SCCs found. The function uses 
- * the TGraph, TArray, and TStack data structures and also calls two additional functions "dfs1" 
- * and "dfs2" to perform depth-first search. The transposeGraph function is used to find the 
- * transpose of the original graph. The function also uses a stack to keep track of the order 
- * of vertices as they are finished in the first dfs, and prints out the SCCs as it finds them. 
- * Finally, it returns an array of TArrays containing all the SCCs and frees any dynamically 
- * allocated memory before returning.
+ * (SCCs) of a directed graph. The algorithm takes in a TGraph (a graph data structure) and start 
+ * and stop indices, and calls two additional functions "dfs1" and "dfs2" to perform iterative 
+ * depth-first search. The transposeGraph function is used to find the transpose of the original 
+ * graph. The function also uses an array to keep track of the order of vertices as they are 
+ * finished in the first dfs, and appends the SCCs to a TSCCs set as it finds them, each one as a 
+ * range of the flat vertices array delimited by the offsets array. Finally, it frees any 
+ * dynamically allocated memory and returns the set.
  * 
  * @version 0.1
  * 
@@ -58,6 +57,8 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <assert.h>
 
 #include "../include/Kosaraju.h"
 
@@ -65,11 +66,13 @@
  * The purpose of the transposeGraph() is to create a new TGraph which is the transpose of the original.
  * The transposeGraph()  will go through the original graph, and get all the neighbor indices in the 
  * original graph, and add them as nodes in the transposed graph.
- * The transposeGraph() function begins by creating a new graph. It then adds the vertices from the original 
- * graph to the new graph. It then iterates through the original graph, and for each node, it gets the list 
- * of the neighbor indices. It then checks if the neighbor index is in the cut (the cut being between the 
- * start and the stop indices). If the neighbor index is in the cut, then it is added to the list of nodes 
- * in the transposed graph.
+ * The transposeGraph() function begins by creating a new graph with the same vertices of the original 
+ * one and without ghosts, since every edge of the transpose ends in a vertex of the original graph. 
+ * Since the graph is stored in CSR form, the transpose is built in two passes: the first one counts, 
+ * for every vertex, the edges entering it from the original graph whose destination is in the cut (the 
+ * cut being between the start and the stop indices), and turns the counts into the offsets of the 
+ * transposed graph; the second one iterates again through the original graph and writes every such edge, 
+ * reversed, in the slot reserved to its destination.
  * 
  * @param graph The original graph
  * @param start The start index of the cut
@@ -78,21 +81,37 @@
 */
 TGraph transposeGraph(TGraph* graph, int start, int stop) {
 
-    TGraph transpose = graphCreate((*graph)->vertices);
+    int vertices = (*graph)->vertices;
+    int *position = (int *) malloc(((*graph)->edges > 0 ? (*graph)->edges : 1) * sizeof(int));
+    int *fill = (int *) calloc(vertices + 1, sizeof(int));
+    int edges = 0;
 
-    for(int i = 0; i < (*graph)->vertices; i++) 
-        transpose->nodes[i].vertex = (*graph)->nodes[i].vertex;
+    for(int j = 0; j < (*graph)->edges; j++) {
+        int elem = (*graph)->targets[j];
+        position[j] = isInCut(elem, start, stop) ? elem : -1;
+        if(position[j] != -1) {
+            fill[position[j] + 1]++;
+            edges++;
+        }
+    }
+
+    TGraph transpose = graphCreate(vertices, edges);
+
+    for(int i = 0; i < vertices; i++) {
+        transpose->ids[i] = (*graph)->ids[i];
+        fill[i + 1] += fill[i];
+        transpose->offsets[i + 1] = fill[i + 1];
+    }
         
-    for(int i = 0; i < (*graph)->vertices; i++) {
-        TArray *adj = getNeighbor(graph, (*graph)->nodes[i].vertex);
-        for(int j = 0; j < adj->length; j++) {
-            int elem = adj->items[j];
-            if(isInCut(graph, elem, start, stop)) {
-                TArray *adj = getNeighbor(&transpose, elem);
-                arrayAdd(adj, (*graph)->nodes[i].vertex);
-            }
+    for(int i = 0; i < vertices; i++) {
+        for(int j = (*graph)->offsets[i]; j < (*graph)->offsets[i + 1]; j++) {
+            if(position[j] != -1)
+                transpose->targets[fill[position[j]]++] = i;
         }
     }
+
+    free(position);
+    free(fill);
     
     return transpose;
 }
@@ -100,128 +119,153 @@ TGraph transposeGraph(TGraph* graph, int start, int stop) {
 
 /**
  * This function performs a depth-first search of a graph starting from a given node.
- * The function starts by searching for the given node in the auxiliary hash table, and setting the 
- * stackMember value to true if it is found. It then gets the neighbors of the node from the graph, 
- * and loops through them. If a neighbor is within the given cut range, it is then searched in the 
- * auxiliary hash table. If it is not found, the dfs1() function is called recursively on the neighbor.
- * Finally, the node is pushed to the stack.
+ * The search is iterative: the path from the starting node to the node being visited is kept in a buffer 
+ * of frames, each holding the position of a node and the index in the CSR targets of its next edge to be 
+ * explored. When a node is visited, its bit in the visited bitset, which is indexed by the position of the 
+ * node minus the start of the cut, is set and a frame is pushed for it. While there are frames, the function 
+ * takes the next edge of the top frame: if its destination is within the given cut range and has not been 
+ * visited yet, the destination is visited. When all the edges of the node of the top frame have been explored, 
+ * the node is appended to the finish order and the frame is popped.
  * 
- * @param node The starting node of the search
+ * @param node The position of the starting node of the search
  * @param graph The graph to be searched
- * @param auxiliaryHT A hash table used for auxiliary data
- * @param stack A stack used for storing visited nodes
+ * @param visited A bitset of the visited nodes of the cut
+ * @param frames A buffer of frames with one entry for every node of the cut
+ * @param order An array with one entry for every node of the cut, storing the nodes in finish order
+ * @param finished A pointer to the number of nodes in the finish order
  * @param start The start of the cut range
  * @param stop The end of the cut range
 */
-void dfs1(int node, TGraph* graph, THTAuxiliarySCC* auxiliaryHT, TStack* stack, int start, int stop) {
+void dfs1(int node, TGraph* graph, uint64_t* visited, TDFSFrame* frames, int* order, int* finished, int start, int stop) {
 
-    TValueHTAuxiliary *val = HTAuxiliarySCCSearch(auxiliaryHT, node);
-    val->stackMember = true;
+    int depth = 0;
+    int *offsets = (*graph)->offsets;
+    int *targets = (*graph)->targets;
 
-    TArray *adj = getNeighbor(graph, node);
-    for(int i = 0; i < adj->length; i++) {
-        if(isInCut(graph, adj->items[i], start, stop)) {
-            TValueHTAuxiliary *neighbor = HTAuxiliarySCCSearch(auxiliaryHT, adj->items[i]);
-            if(!neighbor->stackMember) 
-                dfs1(adj->items[i], graph, auxiliaryHT, stack, start, stop);
-        }
+    BITSET_SET(visited, node - start);
+    frames[depth++] = (TDFSFrame){node, offsets[node]};
+
+    while(depth > 0) {
+        TDFSFrame *frame = &frames[depth - 1];
+        if(frame->edge < offsets[frame->vertex + 1]) {
+            int next = targets[frame->edge++];
+            if(isInCut(next, start, stop) && !BITSET_TEST(visited, next - start)) {
+                BITSET_SET(visited, next - start);
+                frames[depth++] = (TDFSFrame){next, offsets[next]};
+            }
+        } else 
+            order[(*finished)++] = frames[--depth].vertex;
     }
-    stackPush(stack, node);
 }
 
 /**
  * This function performs a depth-first search (DFS) on a transposed graph, starting at a given node, 
  * to find strongly connected components (SCCs) within a specified range.
+ * The search is iterative and uses the same buffer of frames of dfs1(). Every visited node is appended 
+ * to the component buffer and, when the search is over, an SCC of the right length is appended to the 
+ * set of SCCs and filled with the identifiers of the nodes in the component buffer.
  * 
- * @param node The starting node for the DFS
+ * @param node The position of the starting node for the DFS
  * @param transpose A pointer to the transposed graph on which to perform the DFS
- * @param auxiliaryHT A pointer to the auxiliary hash table used to store information about the nodes 
- * during the DFS
+ * @param visited A bitset of the nodes of the cut already visited during the DFS
+ * @param frames A buffer of frames with one entry for every node of the cut
+ * @param component A buffer with one entry for every node of the cut, storing the nodes of the SCC
  * @param start The lower bound of the range in which to search for SCCs
  * @param stop The upper bound of the range in which to search for SCCs
- * @param sccCount A pointer to the variable that keeps track of the number of SCCs found so far
- * @param sccs A pointer to the array that stores the SCCs found
+ * @param sccs A pointer to the set that stores the SCCs found
  */
-void dfs2(int node, TGraph* transpose, THTAuxiliarySCC* auxiliaryHT, int start, int stop, int *sccCount, TArray *sccs) {
-
-    TValueHTAuxiliary *val = HTAuxiliarySCCSearch(auxiliaryHT, node);
-    val->stackMember = true;
-
-    arrayAdd(&sccs[*sccCount], node);
-    TArray *adj = getNeighbor(transpose, node);
-    for(int i = 0; i < adj->length; i++) {
-        if(isInCut(transpose, adj->items[i], start, stop)) {
-            TValueHTAuxiliary *neighbor = HTAuxiliarySCCSearch(auxiliaryHT, adj->items[i]);
-            if(!neighbor->stackMember) 
-                dfs2(adj->items[i], transpose, auxiliaryHT, start, stop, sccCount, sccs);
-        }
+void dfs2(int node, TGraph* transpose, uint64_t* visited, TDFSFrame* frames, int* component, int start, int stop, TSCCs *sccs) {
+
+    int depth = 0, length = 0;
+    int *offsets = (*transpose)->offsets;
+    int *targets = (*transpose)->targets;
+
+    BITSET_SET(visited, node - start);
+    component[length++] = node;
+    frames[depth++] = (TDFSFrame){node, offsets[node]};
+
+    while(depth > 0) {
+        TDFSFrame *frame = &frames[depth - 1];
+        if(frame->edge < offsets[frame->vertex + 1]) {
+            int next = targets[frame->edge++];
+            if(isInCut(next, start, stop) && !BITSET_TEST(visited, next - start)) {
+                BITSET_SET(visited, next - start);
+                component[length++] = next;
+                frames[depth++] = (TDFSFrame){next, offsets[next]};
+            }
+        } else 
+            depth--;
     }
+
+    int *members = sccsAppend(sccs, length);
+    for(int i = 0; i < length; i++)
+        members[i] = (*transpose)->ids[component[i]];
 }
 
 /**
  * The code is an implementation of the Kosaraju's algorithm to find the strongly connected components 
  * (SCCs) in a given graph.
  * 
- *  1.The function starts by creating an auxiliary hash table, called "auxiliaryHT", to store information 
- *    about the nodes during the depth-first search (DFS) process.
- *  2.Then, it creates an array, called "sccs", to store the SCCs that are found.
- *  3.It creates a stack, called "stack", to keep track of the nodes during the DFS process.
+ *  1.The function starts by creating a bitset, called "visited", with one bit for every vertex of the cut, 
+ *    to keep track of the nodes already visited during the depth-first search (DFS) process.
+ *  2.Then, it creates a set, called "sccs", to store the SCCs that are found, with room for all the vertices 
+ *    of the cut.
+ *  3.It preallocates, with one entry for every vertex of the cut, the buffer of frames shared by the two 
+ *    iterative DFS, the "order" array storing the vertices in finish order and the "component" buffer 
+ *    collecting the vertices of an SCC.
  *  4.It creates the transpose of the given graph, called "transpose", by calling the "transposeGraph" 
  *    function.
- *  5.It sets the variable "sccCount" to zero, which will keep track of the number of SCCs found.
- *  6.It initializes the auxiliary hash table by inserting the vertices of the graph into it and setting their 
- *    "stackMember" property to "false".
- *  7.It performs the first DFS by iterating over all the vertices within the given range of "start" and "stop" 
- *    and calling the "dfs1" function on each vertex that is not already on the stack.
- *  8.It reinitializes the auxiliary hash table by inserting the vertices of the graph into it and setting their 
- *    "stackMember" property to "false" again.
- *  9.It performs the second DFS by popping elements from the stack, and for each element, calling the "dfs2" 
- *    function if the element is not already on the stack.
- *  10.It increments the "sccCount" variable for each SCC that is found.
- *  11.Finally, it frees the memory allocated for the auxiliary hash table, the stack and the transposed graph, 
- *     and returns the array of SCCs.
+ *  5.It runs the trimming pre-pass ("trimGraph"), which records the trivial SCCs and marks their vertices in the 
+ *    "trimmed" bitset. The bitset is copied in "visited", so that both DFS skip these vertices.
+ *  6.It performs the first DFS by iterating over all the vertices within the given range of "start" and "stop" 
+ *    and calling the "dfs1" function on each vertex that has not been visited yet.
+ *  7.It resets the "visited" bitset to the "trimmed" one with a memcpy.
+ *  8.It performs the second DFS by scanning the finish order backwards, and for each vertex, calling the "dfs2" 
+ *    function if the vertex has not been visited yet.
+ *  9.Finally, it frees the memory allocated for the bitsets, the buffers and the transposed graph, and returns 
+ *    the set of SCCs.
  * 
  * @param graph The graph on which to perform the Kosaraju algorithm
  * @param start The lower bound of the range in which to search for SCCs
  * @param stop The upper bound of the range in which to search for SCCs
- * @param sccCount A pointer to the variable that keeps track of the number of SCCs found so far
- * @return An array of SCCs
+ * @return The set of SCCs
  */
-TArray* kosaraju(TGraph graph, int start, int stop, int *sccCount) {
+TSCCs kosaraju(TGraph graph, int start, int stop) {
 
-    THTAuxiliarySCC* auxiliaryHT = HTAuxiliarySCCCreate(graph->vertices);
-    TArray *sccs = (TArray *) malloc(graph->vertices * DELTA * sizeof(TArray));
-    TStack stack = stackCreate();
+    int dim = stop - start;
+    int words = BITSET_WORDS(dim) + 1;
+    uint64_t *visited = (uint64_t *) calloc(words, sizeof(uint64_t));
+    uint64_t *trimmed = (uint64_t *) calloc(words, sizeof(uint64_t));
+    TDFSFrame *frames = (TDFSFrame *) malloc((dim > 0 ? dim : 1) * sizeof(TDFSFrame));
+    int *order = (int *) malloc((dim > 0 ? dim : 1) * sizeof(int));
+    int *component = (int *) malloc((dim > 0 ? dim : 1) * sizeof(int));
+    assert(visited != NULL && trimmed != NULL && frames != NULL && order != NULL && component != NULL);
+    TSCCs sccs = sccsCreate(dim);
     TGraph transpose = transposeGraph(&graph, start, stop);
-    
-    *sccCount = 0;
-    
-    for(int i = 0; i < graph->vertices; i++) 
-        HTAuxiliarySCCInsert(auxiliaryHT, graph->nodes[i].vertex, (TValueHTAuxiliary){NOT_INITIALIZED, NOT_INITIALIZED, false});
+    int finished = 0;
+
+    trimGraph(graph, start, stop, trimmed, &sccs);
+    memcpy(visited, trimmed, words * sizeof(uint64_t));
 
     for(int i = start; i < stop; i++) {
-        TValueHTAuxiliary *value = HTAuxiliarySCCSearch(auxiliaryHT, graph->nodes[i].vertex);
-        if(!value->stackMember) 
-            dfs1(graph->nodes[i].vertex, &graph, auxiliaryHT, &stack, start, stop);
+        if(!BITSET_TEST(visited, i - start)) 
+            dfs1(i, &graph, visited, frames, order, &finished, start, stop);
     }
 
-    for(int i = 0; i < graph->vertices; i++) 
-        HTAuxiliarySCCInsert(auxiliaryHT, graph->nodes[i].vertex, (TValueHTAuxiliary){NOT_INITIALIZED, NOT_INITIALIZED, false});
+    memcpy(visited, trimmed, words * sizeof(uint64_t));
 
-    while(!stackIsEmpty(&stack)){
-        int node = stackPop(&stack);
-        TValueHTAuxiliary *value = HTAuxiliarySCCSearch(auxiliaryHT, node);
-        if(!value->stackMember) {
-            sccs[(*sccCount)] = arrayCreate(0, false);
-            dfs2(node, &transpose, auxiliaryHT, start, stop, sccCount, sccs);
-            (*sccCount)++;
-        }
+    for(int i = finished - 1; i >= 0; i--) {
+        int node = order[i];
+        if(!BITSET_TEST(visited, node - start))
+            dfs2(node, &transpose, visited, frames, component, start, stop, &sccs);
     }
 
-    HTAuxiliarySCCDestroy(auxiliaryHT);
-    stackDestroy(&stack);
+    free(visited);
+    free(trimmed);
+    free(frames);
+    free(order);
+    free(component);
     graphDestroy(transpose);
 
     return sccs;
 }
-
@@ -0,0 +1,291 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file Multistep.c
+ * 
+ * @brief Source file for the Multistep pipeline to find the strongly connected components (SCCs) of a 
+ * directed graph. The pipeline takes in a TGraph (a graph data structure), start and stop indices, and 
+ * returns the SCCs found in a TSCCs set, like the other algorithms. Real-world graphs 
+ * usually have a giant SCC and a long tail of small ones, and none of the other algorithms handles both 
+ * well: FW-BW finds a giant SCC with a few parallel searches but has little parallelism on many small 
+ * SCCs, the coloring algorithm is the opposite, and the Tarjan algorithm has no parallelism but the 
+ * lowest overhead. The pipeline runs four phases on the vertices of the cut, each on the vertices left 
+ * by the previous one:
+ * 
+ *  1. The trimming pre-pass removes the vertices with in-degree or out-degree 0 and the cycles of length 2.
+ *  2. A single FW-BW step from the vertex with the highest product of in-degree and out-degree, which most 
+ *     likely belongs to the giant SCC, finds that SCC.
+ *  3. Rounds of the coloring algorithm peel the medium SCCs, until at most MULTISTEP_TARJAN_CUTOFF vertices 
+ *     are left.
+ *  4. The Tarjan algorithm finds the SCCs of the residual subgraph.
+ * 
+ * The time spent in every phase is accumulated in the multistepTimes structure.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <omp.h>
+
+#include "../include/Multistep.h"
+#include "../include/Kosaraju.h"
+#include "../include/FWBW.h"
+#include "../include/Coloring.h"
+#include "../include/Tarjan.h"
+
+TMultistepTimes multistepTimes = {0, 0, 0, 0};
+
+/**
+ * This function finds the giant SCC of the active vertices of a cut. The pivot is the active vertex with the 
+ * highest product of out-degree and in-degree, found with a parallel reduction: the giant SCC, if any, contains 
+ * most of the edges, so this vertex most likely belongs to it. The function then performs a single step of the 
+ * FW-BW algorithm, sharing its searches: the active vertices get the color 1, the forward search from the pivot 
+ * recolors the vertices it reaches, and the backward search on the transpose gives the color of the SCC to the 
+ * vertices reached by both. The forward search repeats its pair of colors instead of passing -1 as the second 
+ * one, as FW-BW does, since -1 is COLORING_DONE here. Both searches run in an OpenMP parallel region, so that their large frontiers are 
+ * expanded by all the threads. Finally the SCC is recorded, its vertices are colored with COLORING_DONE and the 
+ * other vertices are compacted at the beginning of the list of the active vertices.
+ * 
+ * @param graph The graph
+ * @param transpose The transpose of the graph restricted to the cut
+ * @param color The colors of the vertices of the cut
+ * @param active The list of the active vertices, which is updated
+ * @param queue A buffer with one entry per vertex of the cut
+ * @param length The number of active vertices
+ * @param start The start of the cut range
+ * @param stop The end of the cut range
+ * @param sccs The set where the SCC found is stored
+ * @return The number of vertices still active
+*/
+int multistepGiant(TGraph graph, TGraph transpose, int *color, int *active, int *queue, int length, int start, int stop, TSCCs *sccs) {
+
+    TFWBWContext context;
+    long long best = -1;
+    int pivot = active[0], kept = 0, sccLength = 0;
+    int forward = 2, backward = 3, component = 4;
+
+    #pragma omp parallel
+    {
+        long long localBest = -1;
+        int localPivot = active[0];
+
+        #pragma omp for nowait
+        for(int i = 0; i < length; i++) {
+            int v = active[i];
+            long long degree = (long long) (graph->offsets[v + 1] - graph->offsets[v]) * (transpose->offsets[v + 1] - transpose->offsets[v]);
+            if(degree > localBest) {
+                localBest = degree;
+                localPivot = v;
+            }
+        }
+
+        #pragma omp critical
+        if(localBest > best || (localBest == best && localPivot < pivot)) {
+            best = localBest;
+            pivot = localPivot;
+        }
+    }
+
+    context.graph = graph;
+    context.transpose = transpose;
+    context.start = start;
+    context.stop = stop;
+    context.color = color;
+
+    #pragma omp parallel for
+    for(int i = 0; i < length; i++)
+        color[active[i] - start] = 1;
+
+    #pragma omp parallel
+    #pragma omp single
+    {
+        color[pivot - start] = forward;
+        fwbwReach(&context, graph, queue, pivot, 1, forward, 1, forward);
+        color[pivot - start] = component;
+        fwbwReach(&context, transpose, queue, pivot, 1, backward, forward, component);
+    }
+
+    for(int i = 0; i < length; i++) {
+        int v = active[i];
+        if(color[v - start] == component) {
+            color[v - start] = COLORING_DONE;
+            queue[sccLength++] = v;
+        } else 
+            active[kept++] = v;
+    }
+
+    int *members = sccsAppend(sccs, sccLength);
+    for(int i = 0; i < sccLength; i++)
+        members[i] = graph->ids[queue[i]];
+
+    return kept;
+}
+
+/**
+ * This function finds with the Tarjan algorithm the SCCs of the active vertices of a cut. The vertices whose SCC 
+ * has already been found get a disc value of 0, so that the "sccUtil" function treats them as visited vertices 
+ * that are not on the stack, and "sccUtil" is called on every active vertex not visited yet.
+ * 
+ * @param graph The graph
+ * @param color The colors of the vertices of the cut, COLORING_DONE for the vertices whose SCC has been found
+ * @param active The list of the active vertices
+ * @param length The number of active vertices
+ * @param start The start of the cut range
+ * @param stop The end of the cut range
+ * @param sccs The set where the SCCs found are stored
+*/
+void multistepTail(TGraph graph, int *color, int *active, int length, int start, int stop, TSCCs *sccs) {
+
+    int dim = stop - start;
+    int size = dim > 0 ? dim : 1;
+    int time = 0, top = 0;
+    int *disc = (int *) malloc(size * sizeof(int));
+    int *low = (int *) malloc(size * sizeof(int));
+    uint64_t *onStack = (uint64_t *) calloc(BITSET_WORDS(dim) + 1, sizeof(uint64_t));
+    TDFSFrame *frames = (TDFSFrame *) malloc((length > 0 ? length : 1) * sizeof(TDFSFrame));
+    int *st = (int *) malloc((length > 0 ? length : 1) * sizeof(int));
+    assert(disc != NULL && low != NULL && onStack != NULL && frames != NULL && st != NULL);
+
+    #pragma omp parallel for
+    for(int i = 0; i < dim; i++)
+        disc[i] = color[i] == COLORING_DONE ? 0 : NOT_INITIALIZED;
+
+    for(int i = 0; i < length; i++) {
+        if(disc[active[i] - start] == NOT_INITIALIZED)
+            sccUtil(graph, active[i], disc, low, onStack, frames, st, &top, &time, start, stop, sccs);
+    }
+
+    free(disc);
+    free(low);
+    free(onStack);
+    free(frames);
+    free(st);
+}
+
+/**
+ * This function is an implementation of the Multistep pipeline to find the strongly connected components (SCCs) 
+ * in a given range of vertices of a graph.
+ * 
+ *  1.The function starts by creating a set, called "sccs", to store the SCCs that are found, with room for all 
+ *    the vertices of the cut.
+ *  2.It runs the trimming pre-pass ("trimGraph"). The trimmed vertices get the color COLORING_DONE, and the 
+ *    other vertices of the cut are the active ones, with the color 0, since "multistepTail" tells the vertices 
+ *    already done by their color even when the other phases do not run.
+ *  3.If more than MULTISTEP_FWBW_CUTOFF vertices are active, it creates the transpose of the graph restricted 
+ *    to the cut, by calling the "transposeGraph" function, and finds the giant SCC by calling the 
+ *    "multistepGiant" function. The transpose is also created when the coloring phase has to run.
+ *  4.While more than MULTISTEP_TARJAN_CUTOFF vertices are active, it performs a round of the coloring algorithm 
+ *    by calling the "coloringStep" function.
+ *  5.It finds the SCCs of the remaining active vertices by calling the "multistepTail" function.
+ *  6.Finally, it frees the memory allocated for the buffers and the transposed graph, if any, and returns the set of 
+ *    SCCs.
+ * 
+ * The time spent in every phase is added to the multistepTimes structure.
+ * 
+ * @param graph The graph on which to perform the Multistep pipeline
+ * @param start The lower bound of the range in which to search for SCCs
+ * @param stop The upper bound of the range in which to search for SCCs
+ * @return The set of SCCs
+ */
+TSCCs multistep(TGraph graph, int start, int stop) {
+
+    int dim = stop - start;
+    int size = dim > 0 ? dim : 1;
+    double itime = omp_get_wtime();
+    TSCCs sccs = sccsCreate(dim);
+    uint64_t *trimmed = (uint64_t *) calloc(BITSET_WORDS(dim) + 1, sizeof(uint64_t));
+    int *color = (int *) malloc(size * sizeof(int));
+    int *active = (int *) malloc(size * sizeof(int));
+    assert(trimmed != NULL && color != NULL && active != NULL);
+    int length = 0, step = 0;
+
+    trimGraph(graph, start, stop, trimmed, &sccs);
+
+    for(int i = 0; i < dim; i++) {
+        if(BITSET_TEST(trimmed, i))
+            color[i] = COLORING_DONE;
+        else {
+            color[i] = 0;
+            active[length++] = start + i;
+        }
+    }
+
+    free(trimmed);
+    multistepTimes.trim += omp_get_wtime() - itime;
+    itime = omp_get_wtime();
+
+    if(length > MULTISTEP_FWBW_CUTOFF || length > MULTISTEP_TARJAN_CUTOFF) {
+        TGraph transpose = transposeGraph(&graph, start, stop);
+        int *mark = (int *) calloc(size, sizeof(int));
+        int *frontier = (int *) malloc(size * sizeof(int));
+        int *next = (int *) malloc(size * sizeof(int));
+        assert(mark != NULL && frontier != NULL && next != NULL);
+
+        if(length > MULTISTEP_FWBW_CUTOFF)
+            length = multistepGiant(graph, transpose, color, active, frontier, length, start, stop, &sccs);
+
+        multistepTimes.fwbw += omp_get_wtime() - itime;
+        itime = omp_get_wtime();
+
+        while(length > MULTISTEP_TARJAN_CUTOFF)
+            length = coloringStep(graph, transpose, color, mark, active, frontier, next, length, start, stop, &step, &sccs);
+
+        free(mark);
+        free(frontier);
+        free(next);
+        graphDestroy(transpose);
+        multistepTimes.coloring += omp_get_wtime() - itime;
+        itime = omp_get_wtime();
+    }
+
+    multistepTail(graph, color, active, length, start, stop, &sccs);
+    multistepTimes.tarjan += omp_get_wtime() - itime;
+
+    free(color);
+    free(active);
+
+    return sccs;
+}
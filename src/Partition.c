@@ -0,0 +1,256 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file Partition.c
+ * 
+ * @brief Source file for the locality-aware partitioner of the graphs. The MPI processes only look 
+ * for the strongly connected components (SCCs) inside their own partition, and the SCCs spanning 
+ * several partitions are only found by the merge rounds, which condense and ship whole graphs between 
+ * the processes. The partitioner relabels the vertices so that the regions of the graph with many edges 
+ * among them, where the SCCs are, land in the same partition.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <omp.h>
+
+#include "../include/Partition.h"
+#include "../include/Kosaraju.h"
+
+/**
+ * This function compares two integers, for the qsort function.
+ * 
+ * @param a A pointer to the first integer.
+ * @param b A pointer to the second integer.
+ * @return A negative, zero or positive value if the first integer is less than, equal to or greater than the second one.
+*/
+static int partitionCompareInt(const void *a, const void *b) {
+
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * This function returns the cost of a vertex, which is the same balanced among the partitions by 
+ * graphPartitionRange(): GRAPH_PARTITION_VERTEX_WEIGHT plus the out-degree of the vertex.
+ * 
+ * @param graph The graph
+ * @param vertex The position of the vertex
+ * @return The cost of the vertex
+*/
+static long long partitionCost(TGraph graph, int vertex) {
+
+    return (long long) GRAPH_PARTITION_VERTEX_WEIGHT + graph->offsets[vertex + 1] - graph->offsets[vertex];
+}
+
+/**
+ * This function computes a permutation of the vertices of a graph with a size-constrained label propagation.
+ * 
+ *  1.Every vertex starts in a cluster of its own, labelled with its position. The load of a cluster is the sum 
+ *    of the costs of its vertices, and the capacity of a cluster is the total cost divided by the number of 
+ *    partitions, so that a cluster never needs more than two partitions.
+ *  2.In every round, the vertices are visited in parallel. The labels of the neighbors of a vertex, both the 
+ *    ones it reaches and the ones reaching it (through the transpose of the graph), are collected and sorted, 
+ *    so that a neighbor connected in both directions, and thus in the same SCC, counts twice. The vertex moves 
+ *    to the most frequent label, if the cluster of that label has room for it; on ties it keeps its label. The 
+ *    room is reserved with a compare-and-swap on the load of the cluster, which is retried while the cluster 
+ *    still has room, and the move is skipped if another thread has filled it in the meantime, so no load ever 
+ *    exceeds the capacity. A vertex may read a label that another thread is changing, which only delays its 
+ *    convergence.
+ *  3.The rounds stop after the given number, or as soon as a round does not move any vertex.
+ *  4.Finally, the vertices are grouped by label with a counting sort, which keeps the order of the positions 
+ *    inside every cluster and orders the clusters by their label, and so by the position of the vertex that 
+ *    started them.
+ * 
+ * @param graph The graph
+ * @param parts The number of partitions the permutation is computed for
+ * @param rounds The maximum number of rounds of the label propagation
+ * @return The positions of the vertices in the order of the permutation
+*/
+int* partitionOrder(TGraph graph, int parts, int rounds) {
+
+    int n = graph->vertices;
+    TGraph transpose = transposeGraph(&graph, 0, n);
+    int *label = (int *) malloc((n + 1) * sizeof(int));
+    int *order = (int *) malloc((n + 1) * sizeof(int));
+    int *count = (int *) calloc(n + 1, sizeof(int));
+    long long *load = (long long *) malloc((n + 1) * sizeof(long long));
+    assert(label != NULL && order != NULL && count != NULL && load != NULL);
+    long long total = 0;
+    int maxDegree = 0;
+
+    #pragma omp parallel for reduction(+:total) reduction(max:maxDegree)
+    for(int v = 0; v < n; v++) {
+        label[v] = v;
+        load[v] = partitionCost(graph, v);
+        total += load[v];
+        int degree = graph->offsets[v + 1] - graph->offsets[v] + transpose->offsets[v + 1] - transpose->offsets[v];
+        if(degree > maxDegree)
+            maxDegree = degree;
+    }
+
+    long long capacity = total / (parts > 0 ? parts : 1);
+
+    for(int round = 0; round < rounds; round++) {
+
+        int moved = 0;
+
+        #pragma omp parallel reduction(+:moved)
+        {
+            int *labels = (int *) malloc((maxDegree + 1) * sizeof(int));
+            assert(labels != NULL);
+
+            #pragma omp for schedule(dynamic, 1024)
+            for(int v = 0; v < n; v++) {
+                int length = 0;
+                for(int j = graph->offsets[v]; j < graph->offsets[v + 1]; j++)
+                    if(graph->targets[j] < n && graph->targets[j] != v)
+                        labels[length++] = label[graph->targets[j]];
+                for(int j = transpose->offsets[v]; j < transpose->offsets[v + 1]; j++)
+                    if(transpose->targets[j] != v)
+                        labels[length++] = label[transpose->targets[j]];
+                if(length == 0)
+                    continue;
+
+                qsort(labels, length, sizeof(int), partitionCompareInt);
+
+                int current = label[v], best = current, bestCount = 0;
+                long long cost = partitionCost(graph, v);
+                for(int i = 0; i < length; i++)
+                    if(labels[i] == current)
+                        bestCount++;
+                for(int i = 0, j; i < length; i = j) {
+                    for(j = i + 1; j < length && labels[j] == labels[i]; j++);
+                    if(j - i > bestCount && load[labels[i]] + cost <= capacity) {
+                        best = labels[i];
+                        bestCount = j - i;
+                    }
+                }
+
+                if(best != current) {
+                    long long seen = load[best];
+                    while(seen + cost <= capacity) {
+                        long long previous = __sync_val_compare_and_swap(&load[best], seen, seen + cost);
+                        if(previous == seen)
+                            break;
+                        seen = previous;
+                    }
+                    if(seen + cost <= capacity) {
+                        __sync_fetch_and_sub(&load[current], cost);
+                        label[v] = best;
+                        moved++;
+                    }
+                }
+            }
+
+            free(labels);
+        }
+
+        if(moved == 0)
+            break;
+    }
+
+    for(int v = 0; v < n; v++)
+        count[label[v] + 1]++;
+    for(int l = 0; l < n; l++)
+        count[l + 1] += count[l];
+    for(int v = 0; v < n; v++)
+        order[count[label[v]]++] = v;
+
+    free(label);
+    free(count);
+    free(load);
+    graphDestroy(transpose);
+
+    return order;
+}
+
+/**
+ * This function counts the edges of a graph whose endpoints fall in different partitions. The vertices, taken 
+ * in the given order, are split in partitions by graphPartitionRange() on the prefix sum of their degrees in 
+ * that order, exactly as the partitioned loader does, and then every edge between two vertices of the graph is 
+ * checked in parallel.
+ * 
+ * @param graph The graph
+ * @param order The positions of the vertices in the order of the permutation, or NULL for the order of the positions
+ * @param parts The number of partitions
+ * @return The number of edges whose endpoints fall in different partitions
+*/
+long long partitionCutEdges(TGraph graph, int *order, int parts) {
+
+    int n = graph->vertices;
+    int *owner = (int *) malloc((n + 1) * sizeof(int));
+    int *degrees = (int *) malloc((n + 1) * sizeof(int));
+    assert(owner != NULL && degrees != NULL);
+    long long cut = 0;
+
+    degrees[0] = 0;
+    for(int i = 0; i < n; i++) {
+        int v = order != NULL ? order[i] : i;
+        degrees[i + 1] = degrees[i] + graph->offsets[v + 1] - graph->offsets[v];
+    }
+
+    for(int part = 0; part < parts; part++) {
+        int start, stop;
+        graphPartitionRange(degrees, n, part, parts, &start, &stop);
+        for(int i = start; i < stop; i++)
+            owner[order != NULL ? order[i] : i] = part;
+    }
+
+    #pragma omp parallel for reduction(+:cut)
+    for(int v = 0; v < n; v++)
+        for(int j = graph->offsets[v]; j < graph->offsets[v + 1]; j++)
+            if(graph->targets[j] < n && owner[graph->targets[j]] != owner[v])
+                cut++;
+
+    free(owner);
+    free(degrees);
+
+    return cut;
+}
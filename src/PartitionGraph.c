@@ -0,0 +1,100 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file PartitionGraph.c
+ * 
+ * @brief This is a C file containing a program which computes the locality-aware permutation of the 
+ * vertices of a graph in binary format and caches it in a permutation file next to the graph, where the 
+ * partitioned loader of the parallel executables finds it.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/TGraph.h"
+#include "../include/Partition.h"
+
+/** 
+ * The program takes in two command-line arguments: the name of the graph file in binary format and the 
+ * number of MPI processes the permutation is computed for. If the number of command-line arguments is not 
+ * two, or the graph file is not in binary format, it prints a usage message and exits with an error code. 
+ * Otherwise, it loads the graph, computes the permutation with the partitionOrder function and writes it 
+ * with the graphSavePermutation function to a file named as the graph file followed by 
+ * GRAPH_PERMUTATION_SUFFIX. Finally, it prints the number of edges cut by the partitions in the order of the 
+ * identifiers and in the order of the permutation, and exits with a success code.
+ */
+int main(int argc, char** argv) {
+
+  if(argc != 3 || atoi(argv[2]) < 1){
+    fprintf(stderr,"Usage:\n\t%s [binaryFileName] [MPIProcesses]\n", argv[0]);
+    exit(EXIT_FAILURE);
+  }
+
+  int parts = atoi(argv[2]);
+  TGraph graph = popolateGraph(argv[1]);
+
+  if(graph->mapping == NULL) {
+    fprintf(stderr,"The graph file '%s' is not in binary format, convert it with convertGraph first\n", argv[1]);
+    exit(EXIT_FAILURE);
+  }
+
+  int *order = partitionOrder(graph, parts, PARTITION_LP_ROUNDS);
+
+  size_t length = strlen(argv[1]) + sizeof(GRAPH_PERMUTATION_SUFFIX);
+  char *fileName = (char *) malloc(length);
+  snprintf(fileName, length, "%s%s", argv[1], GRAPH_PERMUTATION_SUFFIX);
+  graphSavePermutation(graph, order, fileName);
+
+  printf("Cut edges with %d partitions: %lld in the order of the identifiers, %lld in the order of the permutation, out of %d\n", 
+    parts, partitionCutEdges(graph, NULL, parts), partitionCutEdges(graph, order, parts), graph->edges);
+
+  free(fileName);
+  free(order);
+  graphDestroy(graph);
+
+  exit(EXIT_SUCCESS);
+
+}
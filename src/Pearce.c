@@ -0,0 +1,218 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file Pearce.c
+ * 
+ * @brief Source file for the Pearce's algorithm to find the strongly connected components (SCCs) 
+ * of a directed graph. The algorithm takes in a TGraph (a graph data structure) and start and stop 
+ * indices, and returns the SCCs found in a TSCCs set, like the Tarjan's and the Kosaraju's 
+ * algorithms, so it can be used in the same places. Instead of the discovery time, the 
+ * low value and the stack membership flag of the Tarjan's algorithm, every vertex only has an 
+ * integer, its rindex, and a bit telling whether it is the root of its SCC. When an SCC is 
+ * completed, the rindex of its vertices is set to a component index that counts down from the 
+ * number of vertices of the cut and is always greater than the rindex of any vertex still being 
+ * visited, so the completed vertices need no flag to be told apart.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <limits.h>
+#include <omp.h>
+
+#include "../include/Pearce.h"
+
+/**
+ * This function performs a depth-first search of a graph starting from a given node.
+ * The state of the vertices of the cut is stored in the rindex array and in the root bitset, both indexed 
+ * by the position of the vertex minus the start of the cut. A rindex equal to 0 means that the vertex has 
+ * not been visited yet.
+ * The search is iterative: the path from the starting node to the node being visited is kept at the bottom 
+ * of the frames buffer, each frame holding the position of a node and the index in the CSR targets of its 
+ * next edge to be explored. The vertices that have been visited but whose SCC is not complete yet are kept 
+ * at the top of the same buffer, growing downwards, since a vertex is pushed there only after its frame has 
+ * been popped and so the buffer never holds more entries than the vertices of the cut.
+ * When a node is visited, it gets the next index as rindex and is marked as root. While there are frames, the 
+ * function takes the next edge of the top frame v:
+ * 
+ *  - If the destination w is within the range specified by start and stop and has not been visited yet, 
+ *    w is visited and the loop continues from its frame.
+ * 
+ *  - If the destination w has already been visited and its rindex is lower than the rindex of v, the rindex 
+ *    of v is lowered and v is no longer a root.
+ * 
+ * When all the edges of v have been explored, its frame is popped. If v is a root, the vertices at the top 
+ * of the buffer whose rindex is greater than or equal to the rindex of v form its SCC together with v: an SCC 
+ * of the right length is appended to the set of SCCs and filled with their identifiers, their rindex is set to the current component index and the component index is decremented. Otherwise v is pushed 
+ * on the top of the buffer. Finally, the rindex of v is propagated to the node of the previous frame.
+ * 
+ * @param graph The graph to be searched
+ * @param node The position of the starting node of the search
+ * @param rindex Array of the rindex of the vertices of the cut
+ * @param root Bitset of the vertices of the cut that are roots of their SCC
+ * @param frames A buffer with one entry for every vertex of the cut
+ * @param top A pointer to the first entry of the top of the frames buffer
+ * @param index A pointer to the next index to be assigned
+ * @param component A pointer to the next component index to be assigned
+ * @param start The start of the cut range
+ * @param stop The end of the cut range
+ * @param sccs A pointer to the set that stores the SCCs found
+*/
+void pearceVisit(TGraph graph, int node, int *rindex, uint64_t *root, TDFSFrame *frames, int *top, int *index, int *component, int start, int stop, TSCCs *sccs) {
+
+    int depth = 0;
+    int *offsets = graph->offsets;
+    int *targets = graph->targets;
+
+    rindex[node - start] = (*index)++;
+    BITSET_SET(root, node - start);
+    frames[depth++] = (TDFSFrame){node, offsets[node]};
+
+    while(depth > 0) {
+        TDFSFrame *frame = &frames[depth - 1];
+        int u = frame->vertex;
+        int v = u - start;
+
+        if(frame->edge < offsets[u + 1]) {
+            int next = targets[frame->edge++];
+            if(!isInCut(next, start, stop))
+                continue;
+            int w = next - start;
+            if(rindex[w] == 0) {
+                rindex[w] = (*index)++;
+                BITSET_SET(root, w);
+                frames[depth++] = (TDFSFrame){next, offsets[next]};
+            } else if(rindex[w] < rindex[v]) {
+                rindex[v] = rindex[w];
+                BITSET_CLEAR(root, v);
+            }
+            continue;
+        }
+
+        depth--;
+
+        if(BITSET_TEST(root, v)) {
+            int last = *top;
+            while(last < stop - start && rindex[v] <= rindex[frames[last].vertex - start])
+                last++;
+
+            int length = last - *top + 1;
+            int *members = sccsAppend(sccs, length);
+            members[0] = graph->ids[u];
+            for(int i = *top; i < last; i++) {
+                members[i - *top + 1] = graph->ids[frames[i].vertex];
+                rindex[frames[i].vertex - start] = *component;
+            }
+            rindex[v] = *component;
+            *index -= length;
+            *top = last;
+            (*component)--;
+        } else 
+            frames[--(*top)].vertex = u;
+
+        if(depth > 0) {
+            int parent = frames[depth - 1].vertex - start;
+            if(rindex[v] < rindex[parent]) {
+                rindex[parent] = rindex[v];
+                BITSET_CLEAR(root, parent);
+            }
+        }
+    }
+}
+
+/**
+ * This function is an implementation of the Pearce's algorithm to find the strongly connected components 
+ * (SCCs) in a given range of vertices of a graph.
+ * 
+ *  1.The function starts by creating the rindex array, filled with zeros, and the root bitset, both with 
+ *    one entry for every vertex of the cut. These are the only per-vertex state of the algorithm.
+ *  2.Then, it creates a set, called "sccs", to store the SCCs that are found, and preallocates the buffer 
+ *    of frames, both with room for every vertex of the cut.
+ *  3.It sets the next index to 1 and the next component index to the number of vertices of the cut.
+ *  4.It runs the trimming pre-pass ("trimGraph"), which records the trivial SCCs and marks their vertices in the 
+ *    root bitset: these vertices get the rindex INT_MAX, like the vertices of a completed component, and the 
+ *    bitset is cleared again.
+ *  5.It iterates over all the vertices within the given range of "start" and "stop" and calls the "pearceVisit" 
+ *    function on each vertex that has not been visited yet.
+ *  6.Finally, it frees the memory allocated for the rindex array, the bitset and the buffer, and returns the set 
+ *    of SCCs.
+ * 
+ * @param graph The graph on which to perform the Pearce algorithm
+ * @param start The lower bound of the range in which to search for SCCs
+ * @param stop The upper bound of the range in which to search for SCCs
+ * @return The set of SCCs
+ */
+TSCCs pearce(TGraph graph, int start, int stop) {
+
+    int dim = stop - start;
+    int *rindex = (int *) calloc((dim > 0 ? dim : 1), sizeof(int));
+    uint64_t *root = (uint64_t *) calloc(BITSET_WORDS(dim) + 1, sizeof(uint64_t));
+    TDFSFrame *frames = (TDFSFrame *) malloc((dim > 0 ? dim : 1) * sizeof(TDFSFrame));
+    assert(rindex != NULL && root != NULL && frames != NULL);
+    TSCCs sccs = sccsCreate(dim);
+    int top = dim, index = 1, component = dim;
+
+    trimGraph(graph, start, stop, root, &sccs);
+
+    #pragma omp parallel for
+    for(int i = 0; i < dim; i++) {
+        if(BITSET_TEST(root, i))
+            rindex[i] = INT_MAX;
+    }
+
+    memset(root, 0, (BITSET_WORDS(dim) + 1) * sizeof(uint64_t));
+
+    for(int i = start; i < stop; i++) {
+        if(rindex[i - start] == 0)
+            pearceVisit(graph, i, rindex, root, frames, &top, &index, &component, start, stop, &sccs);
+    }
+
+    free(rindex);
+    free(root);
+    free(frames);
+
+    return sccs;
+}
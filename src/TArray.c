@@ -51,17 +51,21 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include <stdbool.h>
 
 #include "../include/TArray.h"
 
-#define C_EXP 5 //  EXPANSION CONSTANT 
-#define C_RED 10 // REDUCTION CONSTANT
+#define C_EXP 2 //  EXPANSION FACTOR 
+#define C_RED 4 // REDUCTION FACTOR
+#define C_MIN 4 // MINIMUM SIZE AFTER A RESIZE
 
 /**
  * Creates a new dynamic array with a given length and a flag indicating
- * whether the array should be treated as ordered or not.
+ * whether the array should be treated as ordered or not. The array is allocated 
+ * with exactly the given length, since most of the arrays are created with their 
+ * final length, like the strongly connected components found by the algorithms.
  *
  * @param length The length of the array
  * @param ordered A flag indicating whether the array should be treated as ordered or not
@@ -69,7 +73,7 @@
  */
 TArray arrayCreate(int length, bool ordered) {
     TArray a;
-    int size = length + C_EXP;
+    int size = length;
     a.items = (TInfoInt *) malloc(size * sizeof (TInfoInt));
     assert(size == 0 || a.items != NULL);
     a.length = length;
@@ -90,21 +94,76 @@ void arrayDestroy(TArray *a) {
 }
 
 /**
- * Resizes a dynamic array to a given length.
+ * Sets the allocated size of a dynamic array to a given value, never below its length.
+ *
+ * @param a A pointer to the dynamic array
+ * @param size The new allocated size
+ */
+static void arraySetSize(TArray *a, int size) {
+    if (size < a->length)
+        size = a->length;
+    a->items = (TInfoInt *) realloc(a->items, size * sizeof (TInfoInt));
+    assert(size == 0 || a->items != NULL);
+    a->size = size;
+}
+
+/**
+ * Resizes a dynamic array to a given length. The allocated size grows geometrically, 
+ * by a factor of C_EXP, so that adding n elements one at a time costs a number of 
+ * reallocations logarithmic in n, and it shrinks only when the length falls below a 
+ * C_RED-th of the size, to twice the length: an array that grows and shrinks around 
+ * the same length, like a stack, is not reallocated at every operation.
  *
  * @param a A pointer to the dynamic array to be resized
  * @param length The new length of the array
  */
 void arrayResize(TArray *a, int length) {
-    if (length > a->size || length < a->size - C_RED) {
-        int size = length + C_EXP;
-        a->items = (TInfoInt *) realloc(a->items, size * sizeof (TInfoInt));
-        assert(size == 0 || a->items != NULL);
-        a->size = size;
+    if (length > a->size) {
+        int size = a->size * C_EXP;
+        if (size < length)
+            size = length;
+        if (size < C_MIN)
+            size = C_MIN;
+        arraySetSize(a, size);
+    } else if (length < a->size / C_RED && a->size > C_MIN) {
+        int size = length * C_EXP;
+        if (size < C_MIN)
+            size = C_MIN;
+        a->length = length;
+        arraySetSize(a, size);
     }
     a->length = length;
 }
 
+/**
+ * Makes room in a dynamic array for at least a given number of elements, without 
+ * changing its length, so that the following additions do not reallocate it.
+ *
+ * @param a A pointer to the dynamic array
+ * @param size The number of elements the array must be able to hold
+ */
+void arrayReserve(TArray *a, int size) {
+    if (size > a->size)
+        arraySetSize(a, size);
+}
+
+/**
+ * Appends a number of elements at the end of a dynamic array with a single resize and 
+ * a single copy. Unlike arrayAdd(), the elements are neither checked for duplicates 
+ * nor put in order: the caller is in charge of appending elements that keep the array 
+ * valid, like the distinct vertices of a strongly connected component.
+ *
+ * @param a A pointer to the dynamic array
+ * @param items The elements to append
+ * @param n The number of elements to append
+ */
+void arrayAppendN(TArray *a, const TInfoInt *items, int n) {
+    int length = a->length;
+    arrayResize(a, length + n);
+    if (n > 0)
+        memcpy(a->items + length, items, n * sizeof (TInfoInt));
+}
+
 /**
  * Prints the elements of a dynamic array.
  *
@@ -117,6 +176,29 @@ void arrayPrint(TArray *a){
 	}
 }
 
+/**
+ * Finds with a binary search the position of the first element of an ordered dynamic array which is not 
+ * less than a given element, that is the position where the element is or would be inserted.
+ *
+ * @param a A pointer to the ordered dynamic array.
+ * @param info The element to search for.
+ * @return The position, between 0 and the length of the array.
+ */
+static int arraySearch(TArray *a, TInfoInt info){
+
+    int first = 0, last = a->length, chosen;
+
+    while(first < last){
+        chosen = first + (last - first) / 2;
+        if(infoLessInt(a->items[chosen], info))
+            first = chosen + 1;
+        else
+            last = chosen;
+    }
+
+    return first;
+}
+
 /**
  * Adds an element to a dynamic array.
  * If the array is ordered, the element is inserted in the correct position.
@@ -127,32 +209,25 @@ void arrayPrint(TArray *a){
  */
 void arrayAdd(TArray *a, TInfoInt info){
 
-    if(arrayContains(a, info)) return;
-    
-    arrayResize(a, a->length + 1);
     if(!a->ordered) {
+        if(arrayContains(a, info)) return;
+        arrayResize(a, a->length + 1);
         a->items[a->length-1] = info;
         return;
     }
-    int p, flag = 0;
-    for(int i = 0; i < a->length; i++) {
-        if(infoLessInt(info, a->items[i]) && flag == 0){
-            p = i;
-            flag = 1;
-        }
-    }
 
-    if(flag == 0)
-        p = a->length-1;
-    else {
-        for(int i = a->length-1; i > p; i--)
-            a->items[i] = a->items[i - 1];
-    }    
+    int p = arraySearch(a, info);
+    if(p < a->length && a->items[p] == info) return;
+
+    arrayResize(a, a->length + 1);
+    memmove(&a->items[p + 1], &a->items[p], (a->length - 1 - p) * sizeof(TInfoInt));
 	a->items[p] = info;
 }
 
 /**
  * Determines whether a dynamic array contains a given element.
+ * The search is binary if the array is ordered, otherwise it is linear, since the elements of an unordered 
+ * array can be in any position.
  *
  * @param a A pointer to the dynamic array
  * @param info The element to search for in the array
@@ -160,17 +235,14 @@ void arrayAdd(TArray *a, TInfoInt info){
  */
 bool arrayContains(TArray *a, TInfoInt info){
 
-    int first = 0, last = a->length - 1, chosen;
-    
-    while(first <= last){
-        chosen = (first+last)/2;
-        if(a->items[chosen] == info)
-            return true;
-        if(a->items[chosen] < info)
-            first = chosen + 1;
-        else
-            last = chosen - 1;
+    if(a->ordered) {
+        int p = arraySearch(a, info);
+        return p < a->length && a->items[p] == info;
     }
+
+    for(int i = 0; i < a->length; i++)
+        if(a->items[i] == info)
+            return true;
     
     return false;
 }
\ No newline at end of file
@@ -50,72 +50,170 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <assert.h>
 #include <omp.h>
 #include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "../include/TGraph.h"
 
-/**   
- * This function destroy a graph node, that is composed by an array of adjacent nodes and an array 
- * of components.
- * 
- * @param node A pointer to the Node to be destroyed.
+/**
+ * @brief A pair made of a vertex identifier and its position in the builder, used to sort the 
+ * vertices of a graph by identifier.
  */
-void graphNodeDestroy(Node *node){
-
-    arrayDestroy(&(node->adj));
-}
+typedef struct {
+    int vertex;
+    int position;
+} TVertexPosition;
 
 /**
- * Creates a new graph with the specified number of vertices.
+ * Creates a new graph with the specified number of vertices and edges and without ghosts. Only the 
+ * arrays are allocated, the caller is in charge of filling them.
  * 
  * @param vertices The number of vertices in the new graph.
+ * @param edges The number of edges in the new graph.
  * @return A pointer to the new TGraph.
  */
-TGraph graphCreate(int vertices) {
-    TGraph graph = (TGraph) malloc(sizeof(TGraph));
+TGraph graphCreate(int vertices, int edges) {
+    TGraph graph = (TGraph) malloc(sizeof(TGraphNode));
+    assert(graph != NULL);
     graph->vertices = vertices;
-    graph->nodes = (Node *) malloc(vertices * sizeof(Node));
-    for (int i = 0; i < vertices; i++) {
-        graph->nodes[i].adj = arrayCreate(0, false);
-    }
+    graph->ghosts = 0;
+    graph->edges = edges;
+    graph->mapping = NULL;
+    graph->mappingSize = 0;
+    graph->ids = (int *) malloc(vertices * sizeof(int));
+    graph->offsets = (int *) malloc((vertices + 1) * sizeof(int));
+    graph->targets = (int *) malloc(edges * sizeof(int));
+    assert((vertices == 0 || graph->ids != NULL) && graph->offsets != NULL && (edges == 0 || graph->targets != NULL));
+    graph->offsets[0] = 0;
     return graph;
 }
 
 /**
- * This function destroy a TGraph passed as parameter doing the free for all the nodes and the graph struct.
+ * This function destroy a TGraph passed as parameter doing the free for the CSR arrays and the graph struct. 
+ * When the graph has been loaded from a file in binary format, the arrays point into the mapping of the file, 
+ * which is unmapped instead.
  * 
  * @param graph A pointer to the TGraph to be destroyed.
  */
 void graphDestroy(TGraph graph) {
-    for (int i = 0; i < graph->vertices; i++) 
-        graphNodeDestroy(&(graph->nodes[i]));
-    free(graph->nodes);
+    if(graph->mapping != NULL)
+        munmap(graph->mapping, graph->mappingSize);
+    else {
+        free(graph->ids);
+        free(graph->offsets);
+        free(graph->targets);
+    }
     free(graph);
 }
 
 /**
- * This function is used to compare two nodes in order to sort them in ascending order.
+ * This function is used to compare two vertices in order to sort them in ascending order of identifier.
  * 
  * @param a A pointer to the first value to be compared.
  * @param b A pointer to the second value to be compared.
  * @return An integer indicating the relative order of the values pointed to by a and b.
  */
-int compare(const void *a, const void *b) {
-    
+static int compareVertexPosition(const void *a, const void *b) {
 
-    const Node *x = a;   
-    const Node *y = b;
-    
-    int comp =  x->vertex - y->vertex;
+    const TVertexPosition *x = a;   
+    const TVertexPosition *y = b;
+
+    return (x->vertex > y->vertex) - (x->vertex < y->vertex);
+}
+
+/**
+ * This function is used to compare two integers in order to sort them in ascending order.
+ * 
+ * @param a A pointer to the first value to be compared.
+ * @param b A pointer to the second value to be compared.
+ * @return An integer indicating the relative order of the values pointed to by a and b.
+ */
+static int compareInt(const void *a, const void *b) {
+
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * This function scans an integer in a buffer, skipping the whitespace before it. It is a minimal 
+ * replacement for fscanf, which parses the integers one call at a time through the locale-aware 
+ * machinery of the C library and dominates the loading time of large graphs.
+ * 
+ * @param p A pointer to the first character to scan.
+ * @param end A pointer past the last character of the buffer.
+ * @param value A pointer to an integer where the value scanned is stored.
+ * @return A pointer past the integer scanned, or NULL if there is no integer before the end of the buffer.
+ */
+static const char* graphScanInt(const char *p, const char *end, int *value) {
 
-    if (comp < 0)
-        return -1;
+    while(p < end && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t'))
+        p++;
 
-    if (comp > 0)
-        return 1;
+    bool negative = p < end && *p == '-';
+    if(negative)
+        p++;
 
-    return comp;
+    const char *digits = p;
+    int v = 0;
+    while(p < end && *p >= '0' && *p <= '9')
+        v = v * 10 + (*p++ - '0');
+
+    if(p == digits)
+        return NULL;
+
+    *value = negative ? -v : v;
+    return p;
+}
+
+/**
+ * This function moves a split point of a graph file in text format to the beginning of the next line, so 
+ * that every line is parsed by exactly one of the chunks or partitions the file is split in. The split 
+ * points computed with the same arguments are moved to the same line, so two adjacent parts always agree 
+ * on their common bound.
+ * 
+ * @param split A pointer to the split point.
+ * @param first A pointer to the first character the split point can be moved to.
+ * @param end A pointer past the last character of the buffer.
+ * @return A pointer to the beginning of the line after the split point, or end if there is none.
+ */
+static const char* graphLineAfter(const char *split, const char *first, const char *end) {
+
+    if(split < first)
+        split = first;
+    if(split == first)
+        return split;
+
+    const char *newline = memchr(split, '\n', end - split);
+    return newline != NULL ? newline + 1 : end;
+}
+
+/**
+ * This function parses a chunk of the lines of a graph file in text format, appending the vertices and their 
+ * neighbors to a builder. The chunk must start at the beginning of a line.
+ * 
+ * @param p A pointer to the first character of the chunk.
+ * @param end A pointer past the last character of the chunk.
+ * @param builder A pointer to the TGraphBuilder.
+ */
+static void graphParseChunk(const char *p, const char *end, TGraphBuilder *builder) {
+
+    int src, dst;
+
+    while((p = graphScanInt(p, end, &src)) != NULL && (p = graphScanInt(p, end, &dst)) != NULL) {
+        graphBuilderAddVertex(builder, src);
+        while((p = graphScanInt(p, end, &dst)) != NULL && dst != -1)
+            graphBuilderAddEdge(builder, dst);
+        if(p == NULL)
+            break;
+    }
 }
 
 /**
@@ -133,58 +231,460 @@ int compare(const void *a, const void *b) {
  * identifier and the subsequent numbers indicating the node's neighbors. The list of neighbors 
  * starts and ends with the value -1.
  *
- * The function reads the first line of the file to get the number of nodes in the graph and then 
- * creates an instance of TGraph with that number of vertices. It then reads the remaining lines 
- * of the file, one by one, to populate the graph's adjacency lists with the neighbors of each node. 
- * Finally, it sorts the nodes by their identifier and returns the created graph.
+ * If the file starts with GRAPH_BINARY_MAGIC it is in binary format instead, and it is loaded by 
+ * graphLoadBinary().
+ *
+ * The whole graph is loaded, as the only partition of popolateGraphPartition().
  *
  * @param filename A pointer to a character array containing the name of the file to be read.
  * @return A pointer to the populated TGraph.
  *
 */
 TGraph popolateGraph(char *fileName) {
-    
-    FILE *fd;
-    int nNodes;
 
-    fd = fopen(fileName, "rt");
-    if(fd == NULL) {
+    return popolateGraphPartition(fileName, 0, 1);
+}
+
+/**
+ * This function reads the given partition of a graph file, so that every MPI process holds only the 
+ * vertices it owns: the graph returned contains the vertices of the partition with their whole adjacency 
+ * lists, and the neighbors owned by the other partitions become ghosts.
+ *
+ * A file in binary format is split in ranges with roughly the same number of edges and vertices as 
+ * described by graphPartitionRange(), and only the slice of the partition is read by 
+ * graphLoadBinaryPartition(); a single partition is loaded without any copy by graphLoadBinary(). A file 
+ * in text format cannot be indexed by vertex without reading all of it, so the lines after the header are 
+ * split in parts of the same size in bytes, which for this format already tracks the number of edges plus 
+ * a few numbers per vertex, and every split point is moved to the beginning of the next line. A partition only 
+ * parses the lines of its part.
+ *
+ * The part is mapped in memory and parsed in parallel. The function reads the first line to get the 
+ * number of nodes in the graph and splits the lines of the part in one chunk per OpenMP thread, moving 
+ * every split point to the beginning of the next line; the chunks are at least GRAPH_PARSE_MIN_CHUNK 
+ * bytes long, so small files are parsed by fewer threads. Every thread parses its chunk with a 
+ * hand-written scanner into its own TGraphBuilder. The per-thread builders are then merged in parallel 
+ * into a single one, every thread copying its vertices and edges at the positions given by the prefix 
+ * sums of the counts of the previous chunks. Finally, the builder sorts the nodes by their identifier 
+ * and returns the created graph.
+ *
+ * @param filename A pointer to a character array containing the name of the file to be read.
+ * @param part The index of the partition to be read, between 0 and parts - 1.
+ * @param parts The number of partitions the graph is split in.
+ * @return A pointer to the TGraph holding the vertices of the partition.
+ *
+*/
+TGraph popolateGraphPartition(char *fileName, int part, int parts) {
+    
+    struct stat info;
+    int nNodes = 0;
+    int fd = open(fileName, O_RDONLY);
+    if(fd == -1 || fstat(fd, &info) == -1) {
         perror("Errore in apertura del file");
         exit(1);
     }
 
-    if(fscanf(fd, "%d\n", &nNodes) == 1);
+    size_t size = info.st_size;
+    char *text = size > 0 ? mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0) : NULL;
+    close(fd);
+    if(text == MAP_FAILED) {
+        fprintf(stderr, "Error mapping the graph file '%s'\n", fileName);
+        exit(1);
+    }
 
-    TGraph graph = graphCreate(nNodes);
+    if(size >= sizeof(GRAPH_BINARY_MAGIC) - 1 && memcmp(text, GRAPH_BINARY_MAGIC, sizeof(GRAPH_BINARY_MAGIC) - 1) == 0) {
+        munmap(text, size);
+        return parts == 1 ? graphLoadBinary(fileName) : graphLoadBinaryPartition(fileName, part, parts);
+    }
 
-    int src, dst;
-    int i = 0;
-
-    for(i = 0; i < nNodes; i++) {
-        if(fscanf(fd, "%d -1 ", &src) == 1);
-        if(fscanf(fd, "%d ", &dst) == 1);
-        graph->nodes[i].vertex = src;
-        while(dst != -1) {
-            graphAddEdge(&graph, i, dst);
-            if(fscanf(fd, "%d ", &dst) == 1);
+    const char *end = text + size;
+    const char *body = size > 0 ? graphScanInt(text, end, &nNodes) : NULL;
+    if(body == NULL)
+        body = end;
+
+    if(parts > 1) {
+        size_t total = end - body;
+        const char *from = graphLineAfter(body + total / parts * part, body, end);
+        if(part < parts - 1)
+            end = graphLineAfter(body + total / parts * (part + 1), body, end);
+        body = from;
+        nNodes = nNodes / parts + 1;
+    }
+
+    size_t length = end - body;
+    int chunks = omp_get_max_threads();
+    if((size_t) chunks > length / GRAPH_PARSE_MIN_CHUNK)
+        chunks = length / GRAPH_PARSE_MIN_CHUNK > 0 ? length / GRAPH_PARSE_MIN_CHUNK : 1;
+
+    const char **bounds = (const char **) malloc((chunks + 1) * sizeof(const char *));
+    TGraphBuilder *builders = (TGraphBuilder *) malloc(chunks * sizeof(TGraphBuilder));
+    int *vertexBase = (int *) malloc((chunks + 1) * sizeof(int));
+    int *edgeBase = (int *) malloc((chunks + 1) * sizeof(int));
+    assert(bounds != NULL && builders != NULL && vertexBase != NULL && edgeBase != NULL);
+
+    bounds[0] = body;
+    bounds[chunks] = end;
+    for(int t = 1; t < chunks; t++)
+        bounds[t] = graphLineAfter(body + length / chunks * t, bounds[t - 1], end);
+
+    #pragma omp parallel for num_threads(chunks) schedule(static, 1)
+    for(int t = 0; t < chunks; t++) {
+        size_t bytes = bounds[t + 1] - bounds[t];
+        builders[t] = graphBuilderCreate(nNodes / chunks + 1, bytes / 16 + 1);
+        graphParseChunk(bounds[t], bounds[t + 1], &builders[t]);
+    }
+
+    vertexBase[0] = edgeBase[0] = 0;
+    for(int t = 0; t < chunks; t++) {
+        vertexBase[t + 1] = vertexBase[t] + builders[t].vertices;
+        edgeBase[t + 1] = edgeBase[t] + builders[t].edges;
+    }
+
+    TGraphBuilder builder = builders[0];
+
+    if(chunks > 1) {
+        builder = graphBuilderCreate(vertexBase[chunks], edgeBase[chunks]);
+        builder.vertices = vertexBase[chunks];
+        builder.edges = edgeBase[chunks];
+        builder.offsets[builder.vertices] = builder.edges;
+
+        #pragma omp parallel for num_threads(chunks) schedule(static, 1)
+        for(int t = 0; t < chunks; t++) {
+            TGraphBuilder *chunk = &builders[t];
+            memcpy(&builder.ids[vertexBase[t]], chunk->ids, chunk->vertices * sizeof(int));
+            for(int i = 0; i < chunk->vertices; i++)
+                builder.offsets[vertexBase[t] + i] = edgeBase[t] + chunk->offsets[i];
+            memcpy(&builder.targets[edgeBase[t]], chunk->targets, chunk->edges * sizeof(int));
+            free(chunk->ids);
+            free(chunk->offsets);
+            free(chunk->targets);
         }
     }
 
-    fclose(fd);
-    qsort(graph->nodes, graph->vertices, sizeof(Node), compare);
+    free(bounds);
+    free(builders);
+    free(vertexBase);
+    free(edgeBase);
+    if(text != NULL)
+        munmap(text, size);
+
+    return graphBuilderBuild(&builder);
+}
+
+/**
+ * This function maps in memory a graph file in binary format, read-only and shared, and validates its 
+ * header against the magic string, the version and the size of the file.
+ * 
+ * @param filename A pointer to a character array containing the name of the file to be mapped.
+ * @param size A pointer to a size_t where the size of the mapping is stored.
+ * @return A pointer to the header at the beginning of the mapping.
+*/
+static const TGraphFileHeader* graphMapBinary(char *fileName, size_t *size) {
+
+    struct stat info;
+    int fd = open(fileName, O_RDONLY);
+    if(fd == -1 || fstat(fd, &info) == -1) {
+        perror("Errore in apertura del file");
+        exit(1);
+    }
+
+    *size = info.st_size;
+    void *mapping = *size >= sizeof(TGraphFileHeader) ? mmap(NULL, *size, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+    close(fd);
+    if(mapping == MAP_FAILED) {
+        fprintf(stderr, "Error mapping the graph file '%s'\n", fileName);
+        exit(1);
+    }
+
+    const TGraphFileHeader *header = mapping;
+    size_t expected = sizeof(TGraphFileHeader) + ((size_t) header->vertices + header->ghosts + header->vertices + 1 + header->edges) * sizeof(int);
+    if(memcmp(header->magic, GRAPH_BINARY_MAGIC, sizeof(header->magic)) != 0 || header->version != GRAPH_BINARY_VERSION || 
+       header->vertices < 0 || header->ghosts < 0 || header->edges < 0 || *size != expected) {
+        fprintf(stderr, "Invalid graph file '%s'\n", fileName);
+        exit(1);
+    }
+
+    return header;
+}
+
+/**
+ * This function loads a graph from a file in binary format, whose layout is described by TGraphFileHeader. 
+ * The file is mapped in memory read-only and shared by graphMapBinary(), and the CSR arrays of the graph point 
+ * directly into the mapping, so no parsing nor copy is needed and the processes loading the same file on a node 
+ * share its pages in the page cache. The mapping is released by graphDestroy().
+ * 
+ * @param filename A pointer to a character array containing the name of the file to be loaded.
+ * @return A pointer to the loaded TGraph.
+*/
+TGraph graphLoadBinary(char *fileName) {
+
+    size_t size;
+    const TGraphFileHeader *header = graphMapBinary(fileName, &size);
+
+    TGraph graph = (TGraph) malloc(sizeof(TGraphNode));
+    assert(graph != NULL);
+    graph->vertices = header->vertices;
+    graph->ghosts = header->ghosts;
+    graph->edges = header->edges;
+    graph->ids = (int *) ((char *) header + sizeof(TGraphFileHeader));
+    graph->offsets = graph->ids + graph->vertices + graph->ghosts;
+    graph->targets = graph->offsets + graph->vertices + 1;
+    graph->mapping = (void *) header;
+    graph->mappingSize = size;
 
     return graph;
 }
 
-/** 
- * This function add an edge between vertex v1 and v2 in the graph
- *
- * @param graph A pointer to the TGraph.
- * @param u The index of the first vertex.
- * @param v The index of the second vertex.
- */
-void graphAddEdge(TGraph* graph, int v1, int v2) {
-    arrayAdd(&(*graph)->nodes[v1].adj, v2);
+/**
+ * This function computes the first position of a partition of a graph, that is the first position whose cost 
+ * prefix sum reaches the share of the partitions before it. The cost of the vertices before a position is 
+ * GRAPH_PARTITION_VERTEX_WEIGHT times their number plus their edges, which the offsets array already holds 
+ * as a prefix sum of the degrees, so the position is found by a binary search on the offsets.
+ * 
+ * @param offsets The offsets array of the graph.
+ * @param vertices The number of vertices of the graph.
+ * @param part The index of the partition, between 0 and parts.
+ * @param parts The number of partitions the graph is split in.
+ * @return The first position of the partition, or the number of vertices if part is equal to parts.
+*/
+static int graphPartitionBound(const int *offsets, int vertices, int part, int parts) {
+
+    if(part == parts)
+        return vertices;
+
+    long long total = (long long) GRAPH_PARTITION_VERTEX_WEIGHT * vertices + offsets[vertices] - offsets[0];
+    long long target = total * part / parts;
+    int first = 0, last = vertices;
+
+    while(first < last) {
+        int chosen = first + (last - first) / 2;
+        if((long long) GRAPH_PARTITION_VERTEX_WEIGHT * chosen + offsets[chosen] - offsets[0] < target)
+            first = chosen + 1;
+        else
+            last = chosen;
+    }
+
+    return first;
+}
+
+/**
+ * This function computes the range of positions of the vertices owned by a partition of a graph. The 
+ * vertices are split in contiguous ranges with roughly the same cost, where the cost of a range is the 
+ * number of its edges plus GRAPH_PARTITION_VERTEX_WEIGHT times the number of its vertices: splitting by 
+ * vertex count alone gives very different amounts of work to the partitions of graphs whose degrees are 
+ * uneven, while the algorithms visit every vertex and every edge once. The bounds of every range are 
+ * computed independently by graphPartitionBound(), so adjacent partitions always agree on them.
+ * 
+ * @param offsets The offsets array of the graph, which is the prefix sum of the degrees of its vertices.
+ * @param vertices The number of vertices of the graph.
+ * @param part The index of the partition, between 0 and parts - 1.
+ * @param parts The number of partitions the graph is split in.
+ * @param start A pointer to an integer where the first position of the range is stored.
+ * @param stop A pointer to an integer where the position after the last one of the range is stored.
+*/
+void graphPartitionRange(const int *offsets, int vertices, int part, int parts, int *start, int *stop) {
+
+    *start = graphPartitionBound(offsets, vertices, part, parts);
+    *stop = graphPartitionBound(offsets, vertices, part + 1, parts);
+}
+
+/**
+ * This function maps in memory the permutation file of a graph file in binary format, if it exists. The 
+ * permutation is ignored, with a warning, if it does not match the header of the graph or if it is older 
+ * than the graph file, since it was then computed for a different graph.
+ * 
+ * @param filename A pointer to a character array containing the name of the graph file.
+ * @param graph The header of the graph file.
+ * @param size A pointer to a size_t where the size of the mapping is stored.
+ * @return A pointer to the header at the beginning of the mapping, or NULL if there is no valid permutation.
+*/
+static const TGraphPermutationHeader* graphMapPermutation(char *fileName, const TGraphFileHeader *graph, size_t *size) {
+
+    struct stat info, graphInfo;
+    size_t length = strlen(fileName) + sizeof(GRAPH_PERMUTATION_SUFFIX);
+    char *permutationName = (char *) malloc(length);
+    assert(permutationName != NULL);
+    snprintf(permutationName, length, "%s%s", fileName, GRAPH_PERMUTATION_SUFFIX);
+
+    int fd = open(permutationName, O_RDONLY);
+    if(fd == -1) {
+        free(permutationName);
+        return NULL;
+    }
+
+    const TGraphPermutationHeader *header = MAP_FAILED;
+    if(fstat(fd, &info) == 0 && stat(fileName, &graphInfo) == 0 && info.st_mtime >= graphInfo.st_mtime && 
+       (size_t) info.st_size >= sizeof(TGraphPermutationHeader)) {
+        *size = info.st_size;
+        header = mmap(NULL, *size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+
+    if(header != MAP_FAILED) {
+        size_t expected = sizeof(TGraphPermutationHeader) + ((size_t) header->vertices + header->vertices + 1) * sizeof(int);
+        if(memcmp(header->magic, GRAPH_PERMUTATION_MAGIC, sizeof(GRAPH_PERMUTATION_MAGIC)) == 0 && 
+           header->version == GRAPH_PERMUTATION_VERSION && header->vertices == graph->vertices && 
+           header->edges == graph->edges && *size == expected) {
+            free(permutationName);
+            return header;
+        }
+        munmap((void *) header, *size);
+    }
+
+    fprintf(stderr, "Ignoring the stale or invalid permutation file '%s'\n", permutationName);
+    free(permutationName);
+    return NULL;
+}
+
+/**
+ * This function loads a partition of a graph from a file in binary format. The file is mapped in memory 
+ * as in graphLoadBinary(), but only the ids, the offsets and the targets of the vertices of the partition 
+ * are read, together with the ids of their neighbors. 
+ * The vertices of the partition are the range of positions given by graphPartitionRange(), unless the 
+ * graph file has a permutation file, written by graphSavePermutation(): in that case the range is taken 
+ * from the permuted order of the vertices, using the prefix sum of the degrees stored in the permutation 
+ * file, and the identifiers of the range are sorted and searched in the graph.
+ * The adjacency lists of the vertices of the partition are then copied in parallel in a builder, translating 
+ * every neighbor back to its identifier, so that the builder keeps the neighbors in the partition as positions 
+ * and turns the other ones into ghosts. The mappings are released before returning, so the memory held by 
+ * the process only depends on the size of its partition.
+ * 
+ * @param filename A pointer to a character array containing the name of the file to be loaded.
+ * @param part The index of the partition to be loaded, between 0 and parts - 1.
+ * @param parts The number of partitions the graph is split in.
+ * @return A pointer to the TGraph holding the vertices of the partition.
+*/
+TGraph graphLoadBinaryPartition(char *fileName, int part, int parts) {
+
+    size_t size, permutationSize;
+    int start, stop;
+    const TGraphFileHeader *header = graphMapBinary(fileName, &size);
+    const TGraphPermutationHeader *permutation = graphMapPermutation(fileName, header, &permutationSize);
+    TGraphNode view;
+    view.vertices = header->vertices;
+    view.ids = (int *) ((const char *) header + sizeof(TGraphFileHeader));
+    const int *offsets = view.ids + header->vertices + header->ghosts;
+    const int *targets = offsets + header->vertices + 1;
+
+    int *positions;
+    if(permutation != NULL) {
+        const int *order = (const int *) ((const char *) permutation + sizeof(TGraphPermutationHeader));
+        graphPartitionRange(order + header->vertices, header->vertices, part, parts, &start, &stop);
+        positions = (int *) malloc((stop - start + 1) * sizeof(int));
+        assert(positions != NULL);
+        memcpy(positions, &order[start], (stop - start) * sizeof(int));
+        qsort(positions, stop - start, sizeof(int), compareInt);
+        #pragma omp parallel for
+        for(int i = 0; i < stop - start; i++)
+            positions[i] = graphIndexOf(&view, positions[i]);
+        munmap((void *) permutation, permutationSize);
+    } else {
+        graphPartitionRange(offsets, header->vertices, part, parts, &start, &stop);
+        positions = (int *) malloc((stop - start + 1) * sizeof(int));
+        assert(positions != NULL);
+        for(int i = start; i < stop; i++)
+            positions[i - start] = i;
+    }
+
+    int vertices = stop - start, edges = 0;
+    for(int i = 0; i < vertices; i++)
+        edges += offsets[positions[i] + 1] - offsets[positions[i]];
+
+    TGraphBuilder builder = graphBuilderCreate(vertices, edges);
+    builder.vertices = vertices;
+    builder.edges = edges;
+    for(int i = 0; i < vertices; i++)
+        builder.offsets[i + 1] = builder.offsets[i] + offsets[positions[i] + 1] - offsets[positions[i]];
+
+    #pragma omp parallel for
+    for(int i = 0; i < vertices; i++) {
+        int p = positions[i];
+        builder.ids[i] = view.ids[p];
+        for(int j = offsets[p]; j < offsets[p + 1]; j++)
+            builder.targets[builder.offsets[i] + j - offsets[p]] = view.ids[targets[j]];
+    }
+
+    free(positions);
+    munmap((void *) header, size);
+
+    return graphBuilderBuild(&builder);
+}
+
+/**
+ * This function saves a graph to a file in binary format: the header described by TGraphFileHeader followed by 
+ * the ids, offsets and targets arrays of the graph, written as they are in memory.
+ * 
+ * @param graph The TGraph to be saved.
+ * @param filename A pointer to a character array containing the name of the file to be written.
+*/
+void graphSaveBinary(TGraph graph, char *fileName) {
+
+    TGraphFileHeader header;
+    FILE *fd = fopen(fileName, "wb");
+    if(fd == NULL) {
+        perror("Errore in apertura del file");
+        exit(1);
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, GRAPH_BINARY_MAGIC, sizeof(header.magic));
+    header.version = GRAPH_BINARY_VERSION;
+    header.vertices = graph->vertices;
+    header.ghosts = graph->ghosts;
+    header.edges = graph->edges;
+
+    if(fwrite(&header, sizeof(header), 1, fd) != 1 ||
+       fwrite(graph->ids, sizeof(int), graph->vertices + graph->ghosts, fd) != (size_t) (graph->vertices + graph->ghosts) ||
+       fwrite(graph->offsets, sizeof(int), graph->vertices + 1, fd) != (size_t) (graph->vertices + 1) ||
+       fwrite(graph->targets, sizeof(int), graph->edges, fd) != (size_t) graph->edges) {
+        perror("Errore in scrittura del file");
+        exit(1);
+    }
+
+    fclose(fd);
+}
+
+/**
+ * This function saves a permutation of the vertices of a graph to a permutation file: the header described 
+ * by TGraphPermutationHeader, the identifiers of the vertices in the order of the permutation and the prefix 
+ * sum of their degrees in the same order.
+ * 
+ * @param graph The TGraph whose vertices are permuted.
+ * @param order The positions of the vertices of the graph, in the order of the permutation.
+ * @param filename A pointer to a character array containing the name of the file to be written.
+*/
+void graphSavePermutation(TGraph graph, int *order, char *fileName) {
+
+    TGraphPermutationHeader header;
+    int *ids = (int *) malloc((2 * graph->vertices + 1) * sizeof(int));
+    assert(ids != NULL);
+    int *degrees = ids + graph->vertices;
+
+    degrees[0] = 0;
+    for(int i = 0; i < graph->vertices; i++) {
+        ids[i] = graph->ids[order[i]];
+        degrees[i + 1] = degrees[i] + graph->offsets[order[i] + 1] - graph->offsets[order[i]];
+    }
+
+    FILE *fd = fopen(fileName, "wb");
+    if(fd == NULL) {
+        perror("Errore in apertura del file");
+        exit(1);
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, GRAPH_PERMUTATION_MAGIC, sizeof(GRAPH_PERMUTATION_MAGIC));
+    header.version = GRAPH_PERMUTATION_VERSION;
+    header.vertices = graph->vertices;
+    header.edges = graph->edges;
+
+    if(fwrite(&header, sizeof(header), 1, fd) != 1 ||
+       fwrite(ids, sizeof(int), 2 * graph->vertices + 1, fd) != (size_t) (2 * graph->vertices + 1)) {
+        perror("Errore in scrittura del file");
+        exit(1);
+    }
+
+    fclose(fd);
+    free(ids);
 }
 
 /** 
@@ -197,35 +697,403 @@ void graphAddEdge(TGraph* graph, int v1, int v2) {
 void graphPrint(TGraph graph) {
     
     for (int i = 0; i < graph->vertices; i++) {
-        printf("%d -> ", graph->nodes[i].vertex);
-        arrayPrint(&(graph->nodes[i].adj));
+        printf("%d -> ", graph->ids[i]);
+        for (int j = graph->offsets[i]; j < graph->offsets[i + 1]; j++)
+            infoPrintInt(graph->ids[graph->targets[j]]);
         printf("\n");
     }
 }
 
 /**
- * This function takes a TGraph and a vertex identifier as input and returns the adjacency list of 
- * the vertex with the specified identifier. The function performs a binary search on the graph's 
- * nodes to find the node with the desired identifier and then returns a pointer to its adjacency 
- * list. If the node with the specified identifier is not found, the function returns NULL.
+ * This function finds the position of the vertex with the specified identifier. Since the identifiers 
+ * are sorted and distinct, when they span exactly as many values as the vertices (as it happens for 
+ * the generated graphs, whose identifiers go from 0 to vertices - 1) the position is computed directly, 
+ * otherwise the function performs a binary search on the sorted identifiers of the graph.
  * 
- * @param graph A pointer to the TGraph.
- * @param vertex The index of the vertex.
- * @return A pointer to a TArray containing the indices of the neighbors of the given vertex.
-*/
-TArray* getNeighbor(TGraph* graph, int vertex) {
-    
-    int first = 0, last = (*graph)->vertices - 1, chosen;
+ * @param graph The TGraph.
+ * @param vertex The identifier of the vertex.
+ * @return The position of the vertex, or -1 if the vertex does not belong to the graph.
+ */
+int graphIndexOf(TGraph graph, int vertex) {
+
+    int first = 0, last = graph->vertices - 1, chosen;
+
+    if(last >= 0 && graph->ids[last] - graph->ids[0] == last) {
+        chosen = vertex - graph->ids[0];
+        return (chosen >= 0 && chosen <= last) ? chosen : -1;
+    }
     
     while(first <= last){
         chosen = (first+last)/2;
-        if((*graph)->nodes[chosen].vertex == vertex)
-            return &(*graph)->nodes[chosen].adj;
-        if((*graph)->nodes[chosen].vertex < vertex)
+        if(graph->ids[chosen] == vertex)
+            return chosen;
+        if(graph->ids[chosen] < vertex)
             first = chosen + 1;
         else
             last = chosen - 1;
     }
     
-    return NULL;
+    return -1;
+}
+
+/**
+ * This function takes a TGraph and a vertex identifier as input and returns the adjacency list of 
+ * the vertex with the specified identifier. The function performs a binary search on the graph's 
+ * identifiers to find the position of the vertex and then returns a pointer to the slice of the 
+ * targets array holding its neighbors. If the node with the specified identifier is not found, the 
+ * function returns NULL.
+ * 
+ * @param graph A pointer to the TGraph.
+ * @param vertex The identifier of the vertex.
+ * @param length A pointer to an integer where the number of neighbors is stored.
+ * @return A pointer to the positions of the neighbors of the given vertex.
+*/
+int* getNeighbor(TGraph* graph, int vertex, int* length) {
+    
+    int position = graphIndexOf(*graph, vertex);
+
+    if(position == -1) {
+        *length = 0;
+        return NULL;
+    }
+
+    *length = (*graph)->offsets[position + 1] - (*graph)->offsets[position];
+    return &(*graph)->targets[(*graph)->offsets[position]];
+}
+
+/**
+ * Creates a new graph builder. The arrays are allocated with the given capacities, which are 
+ * doubled every time they are exceeded.
+ * 
+ * @param vertices The expected number of vertices.
+ * @param edges The expected number of edges.
+ * @return The new TGraphBuilder.
+ */
+TGraphBuilder graphBuilderCreate(int vertices, int edges) {
+    TGraphBuilder builder;
+    builder.vertices = 0;
+    builder.edges = 0;
+    builder.vertexCapacity = vertices > 0 ? vertices : 1;
+    builder.edgeCapacity = edges > 0 ? edges : 1;
+    builder.ids = (int *) malloc(builder.vertexCapacity * sizeof(int));
+    builder.offsets = (int *) malloc((builder.vertexCapacity + 1) * sizeof(int));
+    builder.targets = (int *) malloc(builder.edgeCapacity * sizeof(int));
+    assert(builder.ids != NULL && builder.offsets != NULL && builder.targets != NULL);
+    builder.offsets[0] = 0;
+    return builder;
+}
+
+/**
+ * Adds a vertex to the graph being built, closing the adjacency list of the previous one.
+ * 
+ * @param builder A pointer to the TGraphBuilder.
+ * @param vertex The identifier of the vertex.
+ */
+void graphBuilderAddVertex(TGraphBuilder* builder, int vertex) {
+    if(builder->vertices == builder->vertexCapacity) {
+        builder->vertexCapacity *= 2;
+        builder->ids = (int *) realloc(builder->ids, builder->vertexCapacity * sizeof(int));
+        builder->offsets = (int *) realloc(builder->offsets, (builder->vertexCapacity + 1) * sizeof(int));
+        assert(builder->ids != NULL && builder->offsets != NULL);
+    }
+    builder->ids[builder->vertices] = vertex;
+    builder->offsets[builder->vertices] = builder->edges;
+    builder->vertices++;
+    builder->offsets[builder->vertices] = builder->edges;
+}
+
+/**
+ * Makes room in the targets array of the builder for at least the given number of edges.
+ * 
+ * @param builder A pointer to the TGraphBuilder.
+ * @param edges The number of edges the builder must be able to hold.
+ */
+static void graphBuilderReserve(TGraphBuilder* builder, int edges) {
+    if(edges <= builder->edgeCapacity)
+        return;
+    while(builder->edgeCapacity < edges)
+        builder->edgeCapacity *= 2;
+    builder->targets = (int *) realloc(builder->targets, builder->edgeCapacity * sizeof(int));
+    assert(builder->targets != NULL);
+}
+
+/**
+ * Adds an edge from the last added vertex to the given vertex.
+ * 
+ * @param builder A pointer to the TGraphBuilder.
+ * @param vertex The identifier of the destination vertex.
+ */
+void graphBuilderAddEdge(TGraphBuilder* builder, int vertex) {
+    graphBuilderReserve(builder, builder->edges + 1);
+    builder->targets[builder->edges++] = vertex;
+    builder->offsets[builder->vertices] = builder->edges;
+}
+
+/**
+ * Adds a list of edges from the last added vertex to the given vertices.
+ * 
+ * @param builder A pointer to the TGraphBuilder.
+ * @param vertices The identifiers of the destination vertices.
+ * @param length The number of destination vertices.
+ */
+void graphBuilderAddEdges(TGraphBuilder* builder, int* vertices, int length) {
+    graphBuilderReserve(builder, builder->edges + length);
+    memcpy(&builder->targets[builder->edges], vertices, length * sizeof(int));
+    builder->edges += length;
+    builder->offsets[builder->vertices] = builder->edges;
+}
+
+/**
+ * This function replaces the identifiers stored in the targets array of a graph with the positions of 
+ * the corresponding vertices, so that the algorithms can reach a neighbor by direct indexing instead of 
+ * searching for it. The identifiers that do not belong to the graph become ghosts: they are encoded as 
+ * negative numbers during the first parallel pass, then collected, sorted and deduplicated, appended to 
+ * the ids array and finally replaced by their positions during the second parallel pass.
+ * 
+ * @param graph The TGraph whose targets are identifiers.
+ */
+static void graphRemapTargets(TGraph graph) {
+
+    int vertices = graph->vertices;
+    int ghosts = 0;
+
+    #pragma omp parallel for reduction(+:ghosts)
+    for(int i = 0; i < graph->edges; i++) {
+        int position = graphIndexOf(graph, graph->targets[i]);
+        if(position == -1) {
+            graph->targets[i] = -graph->targets[i] - 1;
+            ghosts++;
+        } else 
+            graph->targets[i] = position;
+    }
+
+    graph->ghosts = 0;
+    if(ghosts == 0)
+        return;
+
+    int *ghostIds = (int *) malloc(ghosts * sizeof(int));
+    assert(ghostIds != NULL);
+
+    for(int i = 0, j = 0; i < graph->edges; i++)
+        if(graph->targets[i] < 0)
+            ghostIds[j++] = -graph->targets[i] - 1;
+
+    qsort(ghostIds, ghosts, sizeof(int), compareInt);
+
+    int unique = 0;
+    for(int i = 0; i < ghosts; i++)
+        if(unique == 0 || ghostIds[unique - 1] != ghostIds[i])
+            ghostIds[unique++] = ghostIds[i];
+
+    graph->ids = (int *) realloc(graph->ids, (vertices + unique) * sizeof(int));
+    assert(graph->ids != NULL);
+    memcpy(&graph->ids[vertices], ghostIds, unique * sizeof(int));
+    graph->ghosts = unique;
+
+    #pragma omp parallel for
+    for(int i = 0; i < graph->edges; i++) {
+        if(graph->targets[i] < 0) {
+            int vertex = -graph->targets[i] - 1;
+            int first = 0, last = unique - 1, chosen = 0;
+            while(first <= last) {
+                chosen = (first + last) / 2;
+                if(ghostIds[chosen] == vertex)
+                    break;
+                if(ghostIds[chosen] < vertex)
+                    first = chosen + 1;
+                else
+                    last = chosen - 1;
+            }
+            graph->targets[i] = vertices + chosen;
+        }
+    }
+
+    free(ghostIds);
+}
+
+/**
+ * This function sorts an adjacency list with a least significant digit radix sort, 8 bits at a time, 
+ * for as many digits as needed by the largest position of the graph.
+ * 
+ * @param items The adjacency list.
+ * @param scratch A buffer as large as the adjacency list.
+ * @param length The length of the adjacency list.
+ * @param bits The number of significant bits of the positions.
+ */
+static void graphRadixSort(int *items, int *scratch, int length, int bits) {
+
+    int *from = items, 
+        *to = scratch;
+
+    for(int shift = 0; shift < bits; shift += 8) {
+        int count[257] = {0};
+        for(int i = 0; i < length; i++)
+            count[((from[i] >> shift) & 0xFF) + 1]++;
+        for(int d = 0; d < 256; d++)
+            count[d + 1] += count[d];
+        for(int i = 0; i < length; i++)
+            to[count[(from[i] >> shift) & 0xFF]++] = from[i];
+        int *swap = from;
+        from = to;
+        to = swap;
+    }
+
+    if(from != items)
+        memcpy(items, from, length * sizeof(int));
+}
+
+/**
+ * This function sorts every adjacency list of a graph and removes the duplicated edges, which the builder 
+ * collects without any check. The lists are processed in parallel: the ones shorter than 
+ * GRAPH_RADIX_SORT_THRESHOLD are sorted by insertion, the longer ones by graphRadixSort(), so removing the 
+ * duplicates costs O(d) for a list of d edges after the sort instead of a search for every edge added. The 
+ * unique edges are kept at the beginning of every list, and if any duplicate was found the lists are then 
+ * compacted, again in parallel, into a new targets array.
+ * 
+ * @param graph The TGraph whose targets are positions.
+ */
+static void graphSortAdjacency(TGraph graph) {
+
+    int n = graph->vertices;
+    int *unique = (int *) malloc((n + 1) * sizeof(int));
+    assert(unique != NULL);
+
+    int bits = 0;
+    while(bits < 31 && (1 << bits) < graph->vertices + graph->ghosts)
+        bits++;
+
+    long long removed = 0;
+
+    #pragma omp parallel reduction(+:removed)
+    {
+        int *scratch = NULL;
+        int scratchSize = 0;
+
+        #pragma omp for schedule(dynamic, 64)
+        for(int v = 0; v < n; v++) {
+            int *list = &graph->targets[graph->offsets[v]];
+            int length = graph->offsets[v + 1] - graph->offsets[v];
+
+            if(length < GRAPH_RADIX_SORT_THRESHOLD) {
+                for(int i = 1; i < length; i++) {
+                    int item = list[i], 
+                        j = i - 1;
+                    while(j >= 0 && list[j] > item) {
+                        list[j + 1] = list[j];
+                        j--;
+                    }
+                    list[j + 1] = item;
+                }
+            } else {
+                if(length > scratchSize) {
+                    free(scratch);
+                    scratchSize = length;
+                    scratch = (int *) malloc(scratchSize * sizeof(int));
+                    assert(scratch != NULL);
+                }
+                graphRadixSort(list, scratch, length, bits);
+            }
+
+            int kept = length > 0 ? 1 : 0;
+            for(int i = 1; i < length; i++)
+                if(list[i] != list[kept - 1])
+                    list[kept++] = list[i];
+
+            unique[v] = kept;
+            removed += length - kept;
+        }
+
+        free(scratch);
+    }
+
+    if(removed > 0) {
+        int *offsets = (int *) malloc((n + 1) * sizeof(int));
+        int *targets = (int *) malloc((graph->edges - removed > 0 ? graph->edges - removed : 1) * sizeof(int));
+        assert(offsets != NULL && targets != NULL);
+
+        offsets[0] = 0;
+        for(int v = 0; v < n; v++)
+            offsets[v + 1] = offsets[v] + unique[v];
+
+        #pragma omp parallel for schedule(dynamic, 64)
+        for(int v = 0; v < n; v++)
+            memcpy(&targets[offsets[v]], &graph->targets[graph->offsets[v]], unique[v] * sizeof(int));
+
+        free(graph->offsets);
+        free(graph->targets);
+        graph->offsets = offsets;
+        graph->targets = targets;
+        graph->edges = offsets[n];
+    }
+
+    free(unique);
+}
+
+/**
+ * This function builds the TGraph from the content of the builder. If the vertices were not added 
+ * in ascending order of identifier, the adjacency lists are reordered, otherwise the arrays of the 
+ * builder are moved into the graph without any copy. Finally, the identifiers of the neighbors are 
+ * remapped to dense positions, and the adjacency lists are sorted and deduplicated by graphSortAdjacency().
+ * 
+ * @param builder A pointer to the TGraphBuilder.
+ * @return The built TGraph.
+ */
+TGraph graphBuilderBuild(TGraphBuilder* builder) {
+
+    TGraph graph = (TGraph) malloc(sizeof(TGraphNode));
+    assert(graph != NULL);
+    graph->vertices = builder->vertices;
+    graph->edges = builder->edges;
+    graph->mapping = NULL;
+    graph->mappingSize = 0;
+
+    bool sorted = true;
+    for(int i = 1; i < builder->vertices && sorted; i++)
+        sorted = builder->ids[i - 1] < builder->ids[i];
+
+    if(sorted) {
+        graph->ids = builder->ids;
+        graph->offsets = builder->offsets;
+        graph->targets = builder->targets;
+    } else {
+        int n = builder->vertices;
+        TVertexPosition *order = (TVertexPosition *) malloc(n * sizeof(TVertexPosition));
+        assert(order != NULL);
+        for(int i = 0; i < n; i++) {
+            order[i].vertex = builder->ids[i];
+            order[i].position = i;
+        }
+        qsort(order, n, sizeof(TVertexPosition), compareVertexPosition);
+
+        graph->ids = (int *) malloc(n * sizeof(int));
+        graph->offsets = (int *) malloc((n + 1) * sizeof(int));
+        graph->targets = (int *) malloc((builder->edges > 0 ? builder->edges : 1) * sizeof(int));
+        assert(graph->ids != NULL && graph->offsets != NULL && graph->targets != NULL);
+
+        graph->offsets[0] = 0;
+        for(int i = 0; i < n; i++) {
+            int p = order[i].position;
+            graph->ids[i] = order[i].vertex;
+            graph->offsets[i + 1] = graph->offsets[i] + builder->offsets[p + 1] - builder->offsets[p];
+        }
+
+        #pragma omp parallel for
+        for(int i = 0; i < n; i++) {
+            int p = order[i].position;
+            memcpy(&graph->targets[graph->offsets[i]], &builder->targets[builder->offsets[p]], (graph->offsets[i + 1] - graph->offsets[i]) * sizeof(int));
+        }
+
+        free(order);
+        free(builder->ids);
+        free(builder->offsets);
+        free(builder->targets);
+    }
+
+    builder->ids = builder->offsets = builder->targets = NULL;
+    builder->vertices = builder->edges = builder->vertexCapacity = builder->edgeCapacity = 0;
+
+    graphRemapTargets(graph);
+    graphSortAdjacency(graph);
+
+    return graph;
 }
@@ -40,9 +40,9 @@
  * 
  * @file THTAuxiliaryGraph.c
  * 
- * @brief This is an implementation of a hash table with linear probing and open addressing. The code 
- * includes functions for creating and destroying the hash table, inserting and deleting key-value pairs, 
- * and searching for keys in the table. 
+ * @brief This is an implementation of a hash table with open addressing on top of THashTable. The 
+ * code includes functions for creating and destroying the hash table, inserting and deleting key-value 
+ * pairs, and searching for keys in the table, which pass the values to the generic table by address. 
  * 
  * @version 0.1
  * 
@@ -56,146 +56,80 @@
 #include "../include/THTAuxiliaryGraph.h"
 
 /**
-* Creates a new hash table with n entries in the bucket array.
+* Creates a new hash table with room for n keys.
 *
-* @param n The number of entries in the bucket array
-* @return A pointer to the new hash table
+* @param n the number of keys the hash table holds before it grows
+* @return a pointer to the new hash table
 */
 THTAuxiliaryGraph* HTAuxiliaryGraphCreate(int n) {
 	THTAuxiliaryGraph* ht = malloc(sizeof(THTAuxiliaryGraph));
 	assert(ht != NULL);
 
-	ht->bucket = malloc(n * sizeof(TInfoHTAuxiliaryGraph));
-	ht->used = malloc(n * sizeof(int));
-	assert(ht->bucket != NULL && ht->used != NULL);
-
-	for (int i = 0; i < n; i++)
-		ht->used[i] = 0;
-	ht->n_bucket = n;
-	ht->n_used = 0;
+	ht->table = hashTableCreate(n, sizeof(TValueHTAuxiliaryGraph));
 	return ht;
 }
 
 /**
 * Destroys the hash table.
 *
-*@param ht The hash table
+* @param ht the hash table
 */
 void HTAuxiliaryGraphDestroy(THTAuxiliaryGraph* ht) {
-	free(ht->bucket);
-	free(ht->used);
+	hashTableDestroy(&ht->table);
 	free(ht);
 }
 
 /**
-* Inserts a new key-value pair in the hash table.
+* Inserts a new key-value pair in the hash table, replacing the value if the key is already present.
 *
-*@param ht The hash table
-*@param key The key to hash
-*@param value The value to insert
+* @param ht the hash table
+* @param key the key to hash
+* @param value the value to insert
 */
 void HTAuxiliaryGraphInsert(THTAuxiliaryGraph* ht, TKeyHTAuxiliaryGraph key, TValueHTAuxiliaryGraph value) {
-	TValueHTAuxiliaryGraph* p = HTAuxiliaryGraphSearch(ht, key);
-	if (p != NULL) { // si aggiorna solo il valore
-		*p = value;
-		return;
-	}
-
-	if (ht->n_used + 1 >= ht->n_bucket * MAX_LOAD) {
-		HTAuxiliaryGraphResize(ht, ht->n_bucket * GROW_FACTOR + 1);
-	}
-
-	unsigned h = hashHTAuxiliaryGraph(key) % ht->n_bucket;
-	while (ht->used[h])
-		h = (h + 1) % ht->n_bucket;
-	ht->bucket[h].key = key;
-	ht->bucket[h].value = value;
-	ht->used[h] = 1;
-	ht->n_used++;
+	hashTableInsert(&ht->table, key, &value);
 }
 
 /**
 * Searches for a key in the hash table.
 *
-*@param ht The hash table
-*@param key The key to search
-*@return A pointer to the value associated with the key, or NULL if the key is not found
+* @param ht the hash table
+* @param key the key to search
+* @return a pointer to the value associated with the key, or NULL if the key is not found
 */
 TValueHTAuxiliaryGraph* HTAuxiliaryGraphSearch(THTAuxiliaryGraph* ht, TKeyHTAuxiliaryGraph key) {
-	unsigned h = hashHTAuxiliaryGraph(key) % ht->n_bucket;
-	TInfoHTAuxiliaryGraph info = { key };
-	while (ht->used[h] && !infoEqualHTAuxiliaryGraph(info, ht->bucket[h]))
-		h = (h + 1) % ht->n_bucket;
-	if (ht->used[h])
-		return &ht->bucket[h].value;
-	return NULL;
+	return (TValueHTAuxiliaryGraph*) hashTableSearch(&ht->table, key);
 }
 
 /**
 * Deletes a key-value pair from the hash table.
 *
-* @param ht The hash table
-* @param key The key to delete
+* @param ht the hash table
+* @param key the key to delete
 */
 void HTAuxiliaryGraphDelete(THTAuxiliaryGraph* ht, TKeyHTAuxiliaryGraph key) {
-	unsigned h = hashHTAuxiliaryGraph(key) % ht->n_bucket;
-	TInfoHTAuxiliaryGraph info = { key };
-	while (ht->used[h] && !infoEqualHTAuxiliaryGraph(info, ht->bucket[h]))
-		h = (h + 1) % ht->n_bucket;
-	if (ht->used[h]) { 
-		unsigned hole = h;
-		ht->used[hole] = 0; 
-		ht->n_used--;
-		h = (h + 1) % ht->n_bucket;
-		while (ht->used[h]) { 
-			unsigned h1 = hashHTAuxiliaryGraph(ht->bucket[h].key) % ht->n_bucket;
-			if ((h > hole && (h1 <= hole || h1 > h)) || (h < hole && h1 > h && h1 <= hole)) {
-				
-				ht->bucket[hole] = ht->bucket[h]; 
-				ht->used[hole] = 1;
-				hole = h; 
-				ht->used[hole] = 0;
-			}
-			h = (h + 1) % ht->n_bucket;
-		}
-	}
+	hashTableDelete(&ht->table, key);
 }
 
 /**
 * Resizes the hash table.
 *
-* @param ht The hash table
-* @param n The new size of the bucket array
+* @param ht the hash table
+* @param n the number of keys the hash table holds before it grows
 */
 void HTAuxiliaryGraphResize(THTAuxiliaryGraph* ht, int n) {
-	TInfoHTAuxiliaryGraph* bucket = ht->bucket;
-	int* used = ht->used;
-	int n_bucket = ht->n_bucket;
-
-	ht->bucket = malloc(n * sizeof(TInfoHTAuxiliaryGraph));
-	ht->used = malloc(n * sizeof(int));
-	assert(ht->bucket != NULL && ht->used != NULL);
-
-	for (int i = 0; i < n; i++)
-		ht->used[i] = 0;
-	ht->n_bucket = n;
-	ht->n_used = 0;
-
-	for (int i = 0; i < n_bucket; i++)
-		if (used[i])
-			HTAuxiliaryGraphInsert(ht, bucket[i].key, bucket[i].value);
-
-	free(bucket);
-	free(used);
+	hashTableResize(&ht->table, n);
 }
 
 /**
 * Prints the hash table.
 *
-* @param ht he hash table
+* @param ht the hash table
 */
 void HTAuxiliaryGraphPrint(THTAuxiliaryGraph* ht) {
-	for (int i = 0; i < ht->n_bucket; i++)
-		if (ht->used[i])
-			infoPrintHTAuxiliaryGraph(ht->bucket[i]);
-}
\ No newline at end of file
+	for (int i = 0; i < ht->table.capacity; i++)
+		if (HASH_TABLE_FULL(&ht->table, i)) {
+			TInfoHTAuxiliaryGraph info = { ht->table.keys[i], *(TValueHTAuxiliaryGraph*) hashTableValue(&ht->table, i) };
+			infoPrintHTAuxiliaryGraph(info);
+		}
+}
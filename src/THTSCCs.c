@@ -40,9 +40,9 @@
  * 
  * @file THTSCCs.c
  * 
- * @brief This is an implementation of a hash table with linear probing and open addressing 
- * The code includes functions for creating and destroying the hash table, inserting and deleting 
- * key-value pairs, and searching for keys in the table. 
+ * @brief This is an implementation of a hash table with open addressing on top of THashTable. The 
+ * code includes functions for creating and destroying the hash table, inserting and deleting key-value 
+ * pairs, and searching for keys in the table, which pass the values to the generic table by address. 
  * 
  * @version 0.1
  * 
@@ -55,87 +55,50 @@
 #include <assert.h>
 #include "../include/THTSCCs.h"
 
-
-/*
-This file contains the implementation of the auxiliary hash table used in the SCC algorithm, 
-which is a hash table with linear probing and open addressing.
-*/
-
 /**
-* Creates a new hash table with n entries in the bucket array.
+* Creates a new hash table with room for n keys.
 *
-* @param n the number of entries in the bucket array
+* @param n the number of keys the hash table holds before it grows
 * @return a pointer to the new hash table
 */
 THTSCCs* HTSCCsCreate(int n) {
 	THTSCCs* ht = malloc(sizeof(THTSCCs));
 	assert(ht != NULL);
 
-	ht->bucket = malloc(n * sizeof(TInfoHTSCCs));
-	ht->used = malloc(n * sizeof(int));
-	assert(ht->bucket != NULL && ht->used != NULL);
-
-	for (int i = 0; i < n; i++)
-		ht->used[i] = 0;
-	ht->n_bucket = n;
-	ht->n_used = 0;
+	ht->table = hashTableCreate(n, sizeof(TValueHTSCCs));
 	return ht;
 }
 
 /**
 * Destroys the hash table.
 *
-*@param ht the hash table
-*@return 
+* @param ht the hash table
 */
 void HTSCCsDestroy(THTSCCs* ht) {
-	free(ht->bucket);
-	free(ht->used);
+	hashTableDestroy(&ht->table);
 	free(ht);
 }
 
 /**
-* Inserts a new key-value pair in the hash table.
+* Inserts a new key-value pair in the hash table, replacing the value if the key is already present.
 *
-*@param ht the hash table
-*@param key the key to hash
-*@param value the value to insert
-*@return
+* @param ht the hash table
+* @param key the key to hash
+* @param value the value to insert
 */
 void HTSCCsInsert(THTSCCs* ht, TKeyHTSCCs key, TValueHTSCCs value) {
-	TValueHTSCCs* p = HTSCCsSearch(ht, key);
-	if (p != NULL) { // si aggiorna solo il valore
-		*p = value;
-		return;
-	}
-
-	if (ht->n_used + 1 >= ht->n_bucket * MAX_LOAD)
-		HTSCCsResize(ht, ht->n_bucket * GROW_FACTOR + 1);
-
-	unsigned h = hashHTSCCs(key) % ht->n_bucket;
-	while (ht->used[h])
-		h = (h + 1) % ht->n_bucket;
-	ht->bucket[h].key = key;
-	ht->bucket[h].value = value;
-	ht->used[h] = 1;
-	ht->n_used++;
+	hashTableInsert(&ht->table, key, &value);
 }
 
 /**
 * Searches for a key in the hash table.
 *
-*@param ht the hash table
-*@param key the key to search
-*@return a pointer to the value associated with the key, or NULL if the key is not found
+* @param ht the hash table
+* @param key the key to search
+* @return a pointer to the value associated with the key, or NULL if the key is not found
 */
 TValueHTSCCs* HTSCCsSearch(THTSCCs* ht, TKeyHTSCCs key) {
-	unsigned h = hashHTSCCs(key) % ht->n_bucket;
-	TInfoHTSCCs info = { key };
-	while (ht->used[h] && !infoEqualHTSCCs(info, ht->bucket[h]))
-		h = (h + 1) % ht->n_bucket;
-	if (ht->used[h])
-		return &ht->bucket[h].value;
-	return NULL;
+	return (TValueHTSCCs*) hashTableSearch(&ht->table, key);
 }
 
 /**
@@ -143,69 +106,30 @@ TValueHTSCCs* HTSCCsSearch(THTSCCs* ht, TKeyHTSCCs key) {
 *
 * @param ht the hash table
 * @param key the key to delete
-* @return
 */
 void HTSCCsDelete(THTSCCs* ht, TKeyHTSCCs key) {
-	unsigned h = hashHTSCCs(key) % ht->n_bucket;
-	TInfoHTSCCs info = { key };
-	while (ht->used[h] && !infoEqualHTSCCs(info, ht->bucket[h]))
-		h = (h + 1) % ht->n_bucket;
-	if (ht->used[h]) { 
-		unsigned hole = h;
-		ht->used[hole] = 0; 
-		ht->n_used--;
-		h = (h + 1) % ht->n_bucket;
-		while (ht->used[h]) { 
-			unsigned h1 = hashHTSCCs(ht->bucket[h].key) % ht->n_bucket;
-			if ((h > hole && (h1 <= hole || h1 > h)) || (h < hole && h1 > h && h1 <= hole)) {
-				
-				ht->bucket[hole] = ht->bucket[h]; 
-				ht->used[hole] = 1;
-				hole = h; 
-				ht->used[hole] = 0;
-			}
-			h = (h + 1) % ht->n_bucket;
-		}
-	}
+	hashTableDelete(&ht->table, key);
 }
 
 /**
 * Resizes the hash table.
 *
 * @param ht the hash table
-* @param n the new size of the bucket array
-* @return
+* @param n the number of keys the hash table holds before it grows
 */
 void HTSCCsResize(THTSCCs* ht, int n) {
-	TInfoHTSCCs* bucket = ht->bucket;
-	int* used = ht->used;
-	int n_bucket = ht->n_bucket;
-
-	ht->bucket = malloc(n * sizeof(TInfoHTSCCs));
-	ht->used = malloc(n * sizeof(int));
-	assert(ht->bucket != NULL && ht->used != NULL);
-
-	for (int i = 0; i < n; i++)
-		ht->used[i] = 0;
-	ht->n_bucket = n;
-	ht->n_used = 0;
-
-	for (int i = 0; i < n_bucket; i++)
-		if (used[i])
-			HTSCCsInsert(ht, bucket[i].key, bucket[i].value);
-
-	free(bucket);
-	free(used);
+	hashTableResize(&ht->table, n);
 }
 
 /**
 * Prints the hash table.
 *
 * @param ht the hash table
-* @return
 */
 void HTSCCsPrint(THTSCCs* ht) {
-	for (int i = 0; i < ht->n_bucket; i++)
-		if (ht->used[i])
-			infoPrintHTSCCs(ht->bucket[i]);
-}
\ No newline at end of file
+	for (int i = 0; i < ht->table.capacity; i++)
+		if (HASH_TABLE_FULL(&ht->table, i)) {
+			TInfoHTSCCs info = { ht->table.keys[i], *(TValueHTSCCs*) hashTableValue(&ht->table, i) };
+			infoPrintHTSCCs(info);
+		}
+}
@@ -0,0 +1,350 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file THashTable.c
+ * 
+ * @brief This is the implementation of the open addressing hash table shared by the hash tables of the 
+ * program. The position of a key is given by the high bits of a 64-bit mixing hash, so the consecutive 
+ * ids given to the macronodes by calculateId() are spread over the whole table instead of filling runs 
+ * of adjacent slots, and the 7 low bits are kept in the control byte of the slot. A search loads the 
+ * HASH_TABLE_GROUP control bytes starting at the position of the key and compares them at once with the 
+ * control byte of the key: only the slots that match are compared by key, and the search stops at the 
+ * first group with an empty slot. The groups are visited with a triangular sequence, which covers every 
+ * group of a table whose capacity is a power of two.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "../include/THashTable.h"
+
+/**
+ * Returns the bitmask of the slots of a group whose control byte is equal to a given one, comparing the 
+ * HASH_TABLE_GROUP bytes with a single SSE2 instruction when it is available.
+ *
+ * @param control The first control byte of the group
+ * @param byte The control byte to look for
+ * @return The bitmask of the slots matching, the bit i standing for the slot i of the group
+ */
+static inline uint32_t hashTableMatch(const int8_t *control, int8_t byte) {
+#ifdef __SSE2__
+    __m128i group = _mm_loadu_si128((const __m128i *) control);
+    return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(byte)));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < HASH_TABLE_GROUP; i++)
+        if (control[i] == byte)
+            mask |= 1u << i;
+    return mask;
+#endif
+}
+
+/**
+ * Returns the bitmask of the slots of a group that are empty or deleted, that is whose control byte has 
+ * the sign bit set, which SSE2 extracts with a single instruction.
+ *
+ * @param control The first control byte of the group
+ * @return The bitmask of the free slots of the group
+ */
+static inline uint32_t hashTableMatchFree(const int8_t *control) {
+#ifdef __SSE2__
+    return (uint32_t) _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) control));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < HASH_TABLE_GROUP; i++)
+        if (control[i] < 0)
+            mask |= 1u << i;
+    return mask;
+#endif
+}
+
+/**
+ * Sets the control byte of a slot, and its mirror after the end of the table for the first 
+ * HASH_TABLE_GROUP slots.
+ *
+ * @param table A pointer to the table
+ * @param slot The slot
+ * @param byte The control byte
+ */
+static inline void hashTableSetControl(THashTable *table, int slot, int8_t byte) {
+    table->control[slot] = byte;
+    if (slot < HASH_TABLE_GROUP)
+        table->control[table->capacity + slot] = byte;
+}
+
+/**
+ * Returns the smallest capacity, a power of two not lower than HASH_TABLE_GROUP, that holds a given number of 
+ * keys within the maximum load factor.
+ *
+ * @param n The number of keys
+ * @return The capacity
+ */
+static int hashTableCapacity(int n) {
+    int capacity = HASH_TABLE_GROUP;
+    while ((long long) n * 8 > (long long) capacity * HASH_TABLE_MAX_LOAD)
+        capacity *= 2;
+    return capacity;
+}
+
+/**
+ * Allocates the arrays of a table with a given capacity, with all the slots empty.
+ *
+ * @param table A pointer to the table
+ * @param capacity The number of slots, a power of two
+ */
+static void hashTableAllocate(THashTable *table, int capacity) {
+    table->control = (int8_t *) malloc(capacity + HASH_TABLE_GROUP);
+    table->keys = (int *) malloc(capacity * sizeof(int));
+    table->values = (char *) malloc((size_t) capacity * table->valueSize);
+    assert(table->control != NULL && table->keys != NULL && (table->values != NULL || table->valueSize == 0));
+    memset(table->control, HASH_TABLE_EMPTY, capacity + HASH_TABLE_GROUP);
+    table->capacity = capacity;
+    table->count = 0;
+    table->deleted = 0;
+}
+
+/**
+ * Finds the slot of a key.
+ *
+ * @param table A pointer to the table
+ * @param key The key
+ * @param hash The hash of the key
+ * @return The slot of the key, or -1 if the key is not in the table
+ */
+static int hashTableFind(THashTable *table, int key, uint64_t hash) {
+    size_t mask = table->capacity - 1;
+    size_t position = (hash >> 7) & mask;
+    int8_t byte = (int8_t) (hash & 0x7F);
+
+    for (size_t step = HASH_TABLE_GROUP; ; step += HASH_TABLE_GROUP) {
+        const int8_t *group = &table->control[position];
+        uint32_t match = hashTableMatch(group, byte);
+        while (match != 0) {
+            size_t slot = (position + __builtin_ctz(match)) & mask;
+            if (table->keys[slot] == key)
+                return (int) slot;
+            match &= match - 1;
+        }
+        if (hashTableMatch(group, HASH_TABLE_EMPTY) != 0)
+            return -1;
+        position = (position + step) & mask;
+    }
+}
+
+/**
+ * Finds the first free slot, empty or deleted, in the probe sequence of a hash.
+ *
+ * @param table A pointer to the table
+ * @param hash The hash of the key to be placed
+ * @return The free slot
+ */
+static int hashTableFindFree(THashTable *table, uint64_t hash) {
+    size_t mask = table->capacity - 1;
+    size_t position = (hash >> 7) & mask;
+
+    for (size_t step = HASH_TABLE_GROUP; ; step += HASH_TABLE_GROUP) {
+        uint32_t match = hashTableMatchFree(&table->control[position]);
+        if (match != 0)
+            return (int) ((position + __builtin_ctz(match)) & mask);
+        position = (position + step) & mask;
+    }
+}
+
+/**
+ * Creates a table with room for at least a given number of keys, whose values have a given size.
+ *
+ * @param n The number of keys the table holds without growing
+ * @param valueSize The size in bytes of a value
+ * @return The new table
+ */
+THashTable hashTableCreate(int n, int valueSize) {
+    THashTable table;
+    table.valueSize = valueSize;
+    hashTableAllocate(&table, hashTableCapacity(n));
+    return table;
+}
+
+/**
+ * Destroys a table, releasing its arrays.
+ *
+ * @param table A pointer to the table
+ */
+void hashTableDestroy(THashTable *table) {
+    free(table->control);
+    free(table->keys);
+    free(table->values);
+    table->control = NULL;
+    table->keys = NULL;
+    table->values = NULL;
+    table->capacity = table->count = table->deleted = 0;
+}
+
+/**
+ * Computes the hash of a key with the finalizer of MurmurHash3, which spreads every bit of the key over all 
+ * the bits of the hash, so that keys differing only in their low bits, like consecutive ids, get unrelated 
+ * positions.
+ *
+ * @param key The key
+ * @return The 64-bit hash of the key
+ */
+uint64_t hashTableHash(int key) {
+    uint64_t hash = (uint32_t) key;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+/**
+ * Searches for a key in the table. The table is only read, so the searches can run concurrently.
+ *
+ * @param table A pointer to the table
+ * @param key The key to search
+ * @return A pointer to the value of the key, or NULL if the key is not in the table
+ */
+void *hashTableSearch(THashTable *table, int key) {
+    int slot = hashTableFind(table, key, hashTableHash(key));
+    return slot < 0 ? NULL : table->values + (size_t) slot * table->valueSize;
+}
+
+/**
+ * Inserts a key with its value in the table. If the key is already in the table only its value is replaced, 
+ * otherwise the key is placed in the first free slot of its probe sequence, after the table has been grown 
+ * if the new key would exceed the maximum load factor.
+ *
+ * @param table A pointer to the table
+ * @param key The key
+ * @param value A pointer to the value, valueSize bytes long
+ */
+void hashTableInsert(THashTable *table, int key, const void *value) {
+    uint64_t hash = hashTableHash(key);
+    int slot = hashTableFind(table, key, hash);
+
+    if (slot < 0) {
+        if ((long long) (table->count + table->deleted + 1) * 8 > (long long) table->capacity * HASH_TABLE_MAX_LOAD)
+            hashTableResize(table, 2 * (table->count + 1));
+        slot = hashTableFindFree(table, hash);
+        if (table->control[slot] == HASH_TABLE_DELETED)
+            table->deleted--;
+        hashTableSetControl(table, slot, (int8_t) (hash & 0x7F));
+        table->keys[slot] = key;
+        table->count++;
+    }
+
+    memcpy(hashTableValue(table, slot), value, table->valueSize);
+}
+
+/**
+ * Deletes a key from the table. Its slot is marked as deleted rather than empty, so that the searches of 
+ * the keys placed after it go on; the deleted slots are reclaimed by the inserts and by the next resize.
+ *
+ * @param table A pointer to the table
+ * @param key The key to delete
+ */
+void hashTableDelete(THashTable *table, int key) {
+    int slot = hashTableFind(table, key, hashTableHash(key));
+    if (slot < 0)
+        return;
+    hashTableSetControl(table, slot, HASH_TABLE_DELETED);
+    table->count--;
+    table->deleted++;
+}
+
+/**
+ * Rehashes the table with room for at least a given number of keys, and never less than the keys it holds. 
+ * The keys are moved to the new arrays without any search, since they are all distinct, and the deleted 
+ * slots are dropped.
+ *
+ * @param table A pointer to the table
+ * @param n The number of keys the table has to hold
+ */
+void hashTableResize(THashTable *table, int n) {
+    THashTable old = *table;
+
+    hashTableAllocate(table, hashTableCapacity(n > old.count ? n : old.count));
+
+    for (int i = 0; i < old.capacity; i++) {
+        if (!HASH_TABLE_FULL(&old, i))
+            continue;
+        uint64_t hash = hashTableHash(old.keys[i]);
+        int slot = hashTableFindFree(table, hash);
+        hashTableSetControl(table, slot, (int8_t) (hash & 0x7F));
+        table->keys[slot] = old.keys[i];
+        memcpy(hashTableValue(table, slot), hashTableValue(&old, i), table->valueSize);
+    }
+    table->count = old.count;
+
+    hashTableDestroy(&old);
+}
+
+/**
+ * Makes room in the table for at least a given number of keys, so that inserting them costs a single rehash 
+ * instead of one for every doubling.
+ *
+ * @param table A pointer to the table
+ * @param n The number of keys the table has to hold
+ */
+void hashTableReserve(THashTable *table, int n) {
+    if ((long long) (n + table->deleted) * 8 > (long long) table->capacity * HASH_TABLE_MAX_LOAD)
+        hashTableResize(table, n);
+}
+
+/**
+ * Returns a pointer to the value stored in a slot of the table.
+ *
+ * @param table A pointer to the table
+ * @param slot The slot
+ * @return A pointer to the value of the slot
+ */
+void *hashTableValue(THashTable *table, int slot) {
+    return table->values + (size_t) slot * table->valueSize;
+}
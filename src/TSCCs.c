@@ -0,0 +1,270 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file TSCCs.c
+ * 
+ * @brief The source file of the TSCCs module. The sccsCreate() function allocates the two arrays of a set 
+ * of strongly connected components and sccsDestroy() releases them. The sccsAppend() function reserves 
+ * the room of a new SCC at the end of the vertices array, growing the arrays geometrically if needed, and 
+ * returns where the caller writes its vertices, so no memory is allocated per component; sccsAppendShared() 
+ * does the same from concurrent threads and sccsAppendSingletons() reserves many SCCs of one vertex at once. 
+ * The sccsLabel() function converts a set into the label of every vertex and sccsSaveLabels() writes the 
+ * labels in binary form.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <omp.h>
+
+#include "../include/TSCCs.h"
+
+/**
+ * Creates an empty set of SCCs with room for a given number of vertices. The algorithms create it with 
+ * the number of vertices of their cut, since every vertex of the cut ends up in exactly one SCC, so the 
+ * arrays never grow while the SCCs are found.
+ *
+ * @param capacity The number of vertices the set can hold without growing
+ * @return A new empty set of SCCs
+ */
+TSCCs sccsCreate(int capacity) {
+    TSCCs sccs;
+    if (capacity < 1)
+        capacity = 1;
+    sccs.offsets = (int *) malloc((capacity + 1) * sizeof(int));
+    sccs.vertices = (int *) malloc(capacity * sizeof(int));
+    assert(sccs.offsets != NULL && sccs.vertices != NULL);
+    sccs.offsets[0] = 0;
+    sccs.count = 0;
+    sccs.size = 0;
+    sccs.capacity = capacity;
+    return sccs;
+}
+
+/**
+ * Destroys a set of SCCs, releasing its two arrays at once.
+ *
+ * @param sccs A pointer to the set of SCCs to be destroyed
+ */
+void sccsDestroy(TSCCs *sccs) {
+    free(sccs->offsets);
+    free(sccs->vertices);
+    sccs->offsets = sccs->vertices = NULL;
+    sccs->count = sccs->size = sccs->capacity = 0;
+}
+
+/**
+ * Makes room in a set of SCCs for at least a given number of vertices, doubling its capacity until it 
+ * is large enough, so that a sequence of appends costs a constant amortized time each.
+ *
+ * @param sccs A pointer to the set of SCCs
+ * @param capacity The number of vertices the set has to hold
+ */
+void sccsReserve(TSCCs *sccs, int capacity) {
+    if (capacity <= sccs->capacity)
+        return;
+    int grown = sccs->capacity * 2;
+    if (grown < capacity)
+        grown = capacity;
+    sccs->offsets = (int *) realloc(sccs->offsets, (grown + 1) * sizeof(int));
+    sccs->vertices = (int *) realloc(sccs->vertices, grown * sizeof(int));
+    assert(sccs->offsets != NULL && sccs->vertices != NULL);
+    sccs->capacity = grown;
+}
+
+/**
+ * Appends a new SCC to a set of SCCs: the room of its vertices is reserved at the end of the vertices 
+ * array and the offset of the next SCC is recorded. The caller writes the vertices of the SCC in the 
+ * returned buffer, which stays valid until the next append.
+ *
+ * @param sccs A pointer to the set of SCCs
+ * @param length The number of vertices of the SCC
+ * @return A pointer to the room of the vertices of the SCC
+ */
+int *sccsAppend(TSCCs *sccs, int length) {
+    sccsReserve(sccs, sccs->size + length);
+    int *vertices = &sccs->vertices[sccs->size];
+    sccs->size += length;
+    sccs->offsets[++sccs->count] = sccs->size;
+    return vertices;
+}
+
+/**
+ * Appends a new SCC to a set of SCCs like sccsAppend(), from a thread running concurrently with other 
+ * ones appending to the same set. The slot of the SCC and the room of its vertices are reserved together 
+ * in a critical section, so that the offsets stay in the order of the vertices; the vertices are then 
+ * written by the caller outside of it. The arrays are never grown here, since the other threads may be 
+ * writing into them, so the set must have been created with enough capacity.
+ *
+ * @param sccs A pointer to the set of SCCs
+ * @param length The number of vertices of the SCC
+ * @return A pointer to the room of the vertices of the SCC
+ */
+int *sccsAppendShared(TSCCs *sccs, int length) {
+    int first;
+
+    #pragma omp critical(sccsAppend)
+    {
+        assert(sccs->size + length <= sccs->capacity);
+        first = sccs->size;
+        sccs->size += length;
+        sccs->offsets[++sccs->count] = sccs->size;
+    }
+
+    return &sccs->vertices[first];
+}
+
+/**
+ * Appends a given number of SCCs of one vertex to a set of SCCs. Their offsets are filled in parallel, 
+ * and the caller writes the vertex of every SCC in the returned buffer.
+ *
+ * @param sccs A pointer to the set of SCCs
+ * @param count The number of SCCs to append
+ * @return A pointer to the room of the vertices of the SCCs, one per SCC
+ */
+int *sccsAppendSingletons(TSCCs *sccs, int count) {
+    sccsReserve(sccs, sccs->size + count);
+    int *vertices = &sccs->vertices[sccs->size];
+    int *offsets = &sccs->offsets[sccs->count + 1];
+    int base = sccs->size + 1;
+
+    #pragma omp parallel for
+    for (int i = 0; i < count; i++)
+        offsets[i] = base + i;
+
+    sccs->size += count;
+    sccs->count += count;
+    return vertices;
+}
+
+/**
+ * Fills an array, provided by the caller with one entry per original vertex, with the label of every vertex: 
+ * the index of its SCC in the set. The SCCs are processed in parallel. A member of an SCC lower than the number 
+ * of original vertices is a vertex of the original graph and is labeled directly, while a greater one is a 
+ * macronode created by a merge round, whose members are found in the hash table of the macronodes and may be 
+ * macronodes themselves: they are expanded with an explicit stack owned by the thread, instead of the 
+ * recursion of printNode(). The entries of the identifiers that are not vertices of the graph are set to -1.
+ *
+ * @param sccs A pointer to the set of SCCs
+ * @param numOriginalVertices The number of entries of the labels, one more than the greatest original vertex
+ * @param sccsHT The hash table of the macronodes, or NULL if the set has no macronode
+ * @param label The array of the labels, with numOriginalVertices entries
+ */
+void sccsLabel(TSCCs *sccs, int numOriginalVertices, THTSCCs *sccsHT, int *label) {
+
+    #pragma omp parallel for
+    for (int v = 0; v < numOriginalVertices; v++)
+        label[v] = -1;
+
+    #pragma omp parallel
+    {
+        int capacity = 64, top = 0;
+        int *stack = (int *) malloc(capacity * sizeof(int));
+        assert(stack != NULL);
+
+        #pragma omp for schedule(dynamic, 64)
+        for (int i = 0; i < sccs->count; i++) {
+            for (int j = sccs->offsets[i]; j < sccs->offsets[i + 1]; j++) {
+                if (sccs->vertices[j] < numOriginalVertices) {
+                    label[sccs->vertices[j]] = i;
+                    continue;
+                }
+                stack[top++] = sccs->vertices[j];
+                while (top > 0) {
+                    int node = stack[--top];
+                    if (node < numOriginalVertices) {
+                        label[node] = i;
+                        continue;
+                    }
+                    TValueHTSCCs *value = HTSCCsSearch(sccsHT, node);
+                    if (top + value->length > capacity) {
+                        while (top + value->length > capacity)
+                            capacity *= 2;
+                        stack = (int *) realloc(stack, capacity * sizeof(int));
+                        assert(stack != NULL);
+                    }
+                    memcpy(&stack[top], value->items, value->length * sizeof(int));
+                    top += value->length;
+                }
+            }
+        }
+
+        free(stack);
+    }
+}
+
+/**
+ * Saves the labels of the vertices of a graph to a labels file: the header described by TSCCsLabelsHeader 
+ * followed by the labels, written with a single fwrite.
+ *
+ * @param label The labels of the vertices, indexed by identifier
+ * @param vertices The number of labels
+ * @param components The number of SCCs
+ * @param fileName A pointer to a character array containing the name of the file to be written
+ */
+void sccsSaveLabels(int *label, int vertices, int components, char *fileName) {
+
+    TSCCsLabelsHeader header;
+    FILE *fd = fopen(fileName, "wb");
+    if (fd == NULL) {
+        perror("Errore in apertura del file");
+        exit(1);
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SCCS_LABELS_MAGIC, sizeof(header.magic));
+    header.version = SCCS_LABELS_VERSION;
+    header.vertices = vertices;
+    header.components = components;
+
+    if (fwrite(&header, sizeof(header), 1, fd) != 1 ||
+        fwrite(label, sizeof(int), vertices, fd) != (size_t) vertices) {
+        perror("Errore in scrittura del file");
+        exit(1);
+    }
+
+    fclose(fd);
+}
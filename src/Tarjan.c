@@ -51,6 +51,8 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <assert.h>
 #include <omp.h>
 
 #include "../include/Tarjan.h"
@@ -58,79 +60,99 @@
 /**
  * An helper function for finding the strongly connected components (SCCs) in a graph.
  *
- * The function starts by incrementing the time variable and setting the discovery time and low value
- * of the current vertex u in the hash table. The vertex u is then added to the stack and the flag
- * indicating that it is a member of the stack is set to true.
- * Next, the function iterates over the neighbors of u, represented as an array adj, and for each neighbor
- * v that is within the range specified by start and stop, it does the following:
- *
- *  - If the neighbor v has not been visited yet, the function recursively calls itself on v, and updates
- *    the low value of u to be the minimum between its current low value and the low value of v.
- *
- *  - If the neighbor v has already been visited and is a member of the stack, the function updates the low
+ * The state of the vertices of the cut is stored in flat arrays indexed by the position of the vertex 
+ * minus the start of the cut: disc and low hold the discovery time and the low value, onStack is a bitset 
+ * with one bit per vertex telling whether the vertex is a member of the stack.
+ * The depth-first search is iterative: instead of recursing, the function keeps a buffer of frames, one 
+ * for every vertex on the current path, each holding the position of the vertex and the index in the CSR 
+ * targets of its next edge to be explored. Both the frames and the stack of the algorithm are preallocated 
+ * by the caller with one entry per vertex of the cut, which is the maximum depth they can reach, so the 
+ * traversal of long paths is not bounded by the stack of the thread and does not pay the call overhead.
+ * When a vertex is visited, the function increments the time variable, sets the discovery time and low value 
+ * of the vertex, pushes it on the stack, sets its bit in onStack and pushes a frame for it.
+ * Then, while there are frames, the function takes the top frame u and:
+ *
+ *  - If u has an edge left whose destination v is within the range specified by start and stop and has not 
+ *    been visited yet, v is visited and the loop continues from its frame.
+ *
+ *  - If the destination v has already been visited and is a member of the stack, the function updates the low
  *    value of u to be the minimum between its current low value and the discovery time of v.
  *
- * After the loop, the function checks if the low value of u is equal to its discovery time, indicating that
- * u is the root of a SCC. If this is the case, the function creates a new dynamic array in the array containing
- * the scc found and adds all stack vertices that belong to this scc to it. The function * also updates the
- * stackMember flag of each vertex in the scc to false and removes them from the stack. Finally, the function
- * increments the sccCount variable in order to update the total number of sccs.
+ *  - If all the edges of u have been explored, the function checks if the low value of u is equal to its 
+ *    discovery time, indicating that u is the root of a SCC. If this is the case, the vertices on the stack 
+ *    down to u form the SCC: an SCC of the right length is appended to the set of the SCCs found and filled 
+ *    with their identifiers, their bit in onStack is cleared and they are removed from the stack. Finally, the frame of u is popped and the low value of 
+ *    its parent is updated to be the minimum between its current low value and the low value of u.
  *
  * @param graph Pointer to the graph structure.
- * @param u The current node being visited.
- * @param auxiliaryHT Pointer to a hash table that stores auxiliary information for each node in the graph.
- * @param st Pointer to a stack used to track nodes during the SCC search.
+ * @param root The position of the node from which the search starts.
+ * @param disc Array of the discovery times of the vertices of the cut.
+ * @param low Array of the low values of the vertices of the cut.
+ * @param onStack Bitset of the vertices of the cut that are members of the stack.
+ * @param frames Buffer of frames of the depth-first search.
+ * @param st Buffer holding the stack of the vertices of the SCCs not completed yet.
+ * @param top Pointer to the number of vertices in the stack.
  * @param time Pointer to a variable that tracks the current time.
  * @param start The index of the first node in the subgraph being searched.
  * @param stop The index of the last node in the subgraph being searched.
- * @param sccCount Pointer to a variable that tracks the number of SCCs found.
- * @param sccs Pointer to an array of nodes representing the SCCs found.
+ * @param sccs Pointer to the set of the SCCs found.
  */
-void sccUtil(TGraph graph, int u, THTAuxiliarySCC *auxiliaryHT, TStack *st, int *time, int start, int stop, int *sccCount, TArray *sccs)
+void sccUtil(TGraph graph, int root, int *disc, int *low, uint64_t *onStack, TDFSFrame *frames, int *st, int *top, int *time, int start, int stop, TSCCs *sccs)
 {
 
-    TValueHTAuxiliary *val = HTAuxiliarySCCSearch(auxiliaryHT, u);
-    val->disc = val->low = ++(*time);
-    stackPush(st, u);
-    val->stackMember = true;
+    int depth = 0;
 
-    TArray *adj = getNeighbor(&graph, u);
+    disc[root - start] = low[root - start] = ++(*time);
+    st[(*top)++] = root;
+    BITSET_SET(onStack, root - start);
+    frames[depth++] = (TDFSFrame){root, graph->offsets[root]};
 
-    for (int i = 0; i < adj->length; i++)
+    while (depth > 0)
     {
-        if (isInCut(&graph, adj->items[i], start, stop))
+        TDFSFrame *frame = &frames[depth - 1];
+        int u = frame->vertex;
+        int x = u - start;
+
+        if (frame->edge < graph->offsets[u + 1])
         {
-            TValueHTAuxiliary *neighbor = HTAuxiliarySCCSearch(auxiliaryHT, adj->items[i]);
-            if (neighbor->disc == -1)
+            int v = graph->targets[frame->edge++];
+            if (!isInCut(v, start, stop))
+                continue;
+
+            int y = v - start;
+            if (disc[y] == NOT_INITIALIZED)
             {
-                sccUtil(graph, adj->items[i], auxiliaryHT, st, time, start, stop, sccCount, sccs);
-                val->low = min(val->low, neighbor->low);
+                disc[y] = low[y] = ++(*time);
+                st[(*top)++] = v;
+                BITSET_SET(onStack, y);
+                frames[depth++] = (TDFSFrame){v, graph->offsets[v]};
             }
-            else if (neighbor->stackMember == true)
-                val->low = min(val->low, neighbor->disc);
+            else if (BITSET_TEST(onStack, y))
+                low[x] = min(low[x], disc[y]);
+            continue;
         }
-    }
 
-    int w = 0;
-
-    if (val->low == val->disc)
-    {
-        sccs[*sccCount] = arrayCreate(0, false);
-        while (stackTop(st) != u)
+        if (low[x] == disc[x])
         {
-            w = stackTop(st);
-            arrayAdd(&sccs[*sccCount], w);
-            TValueHTAuxiliary *value = HTAuxiliarySCCSearch(auxiliaryHT, w);
-            value->stackMember = false;
-            stackPop(st);
+            int first = *top;
+            do
+            {
+                first--;
+                BITSET_CLEAR(onStack, st[first] - start);
+            } while (st[first] != u);
+
+            int *members = sccsAppend(sccs, *top - first);
+            for (int i = first; i < *top; i++)
+                members[i - first] = graph->ids[st[i]];
+            *top = first;
         }
-        w = stackTop(st);
 
-        arrayAdd(&sccs[*sccCount], w);
-        TValueHTAuxiliary *value = HTAuxiliarySCCSearch(auxiliaryHT, w);
-        value->stackMember = false;
-        stackPop(st);
-        (*sccCount)++;
+        depth--;
+        if (depth > 0)
+        {
+            int p = frames[depth - 1].vertex - start;
+            low[p] = min(low[p], low[x]);
+        }
     }
 }
 
@@ -138,51 +160,69 @@ void sccUtil(TGraph graph, int u, THTAuxiliarySCC *auxiliaryHT, TStack *st, int
  * This function finds the strongly connected components (SCCs) in a given range of vertices of a
  * graph.
  *
- * The function starts by initializing the variables time and auxiliaryHT, which is a hash table that
- * stores auxiliary information about each vertex. It also creates an empty stack st and an
- * array sccs to store the scc found. The sccCount variable is initialized to 0.
- * Next, the function iterates over all the vertices in the graph and inserts them in the hash table
- * with default values for their discovery time, low value, and stack membership flag.
+ * The function starts by initializing the variable time and the state of the vertices of the cut: the 
+ * arrays disc and low, with one entry per vertex of the cut, are filled with NOT_INITIALIZED by a memset 
+ * and the onStack bitset is cleared. It also creates an empty stack st and a set sccs to store the scc 
+ * found, with room for all the vertices of the cut. The frames of the depth-first search and the stack are 
+ * preallocated with one entry per vertex of the cut.
+ * The trimming pre-pass (trimGraph) records the trivial SCCs of the cut, marking their vertices in onStack: 
+ * these vertices get a disc value of 0, so that they are treated as visited vertices that are not on the 
+ * stack, and the bitset is cleared again.
  * Then, the function iterates over the vertices in the specified range [start, stop), and for each
  * vertex u that has not been visited yet, it calls the SSCUtil function to find the SCCs rooted at u.
- * After the loop, the function frees the resources used by the hash table and the stack, and returns the
- * array of SCC vertices.
+ * After the loop, the function frees the state arrays, the frames and the stack, and returns the set of 
+ * the SCCs.
  *
  * @param graph a graph data structure represented as an adjacency list.
  * @param start the index of the first vertex in the graph that should be considered in the traversal.
  * @param stop the index of the last vertex in the graph that should be considered in the traversal.
- * @param sccCount a pointer to a variable that stores the number of SCCs found.
- * @return an array of nodes representing the SCCs found in the graph.
+ * @return the set of the SCCs found in the graph.
  */
-TArray *scc(TGraph graph, int start, int stop, int *sccCount)
+TSCCs scc(TGraph graph, int start, int stop)
 {
 
     int time = 0;
     int dim = stop - start;
 
-    THTAuxiliarySCC *auxiliaryHT = HTAuxiliarySCCCreate(graph->vertices);
-    TStack st = stackCreate();
-    TArray *sccs = (TArray *)malloc(graph->vertices * 10 * sizeof(TArray));
+    int *disc = (int *)malloc((dim > 0 ? dim : 1) * sizeof(int));
+    int *low = (int *)malloc((dim > 0 ? dim : 1) * sizeof(int));
+    uint64_t *onStack = (uint64_t *)calloc(BITSET_WORDS(dim) + 1, sizeof(uint64_t));
+    assert(disc != NULL && low != NULL && onStack != NULL);
+    memset(disc, NOT_INITIALIZED, dim * sizeof(int));
 
-    *sccCount = 0;
+    TDFSFrame *frames = (TDFSFrame *)malloc((dim > 0 ? dim : 1) * sizeof(TDFSFrame));
+    int *st = (int *)malloc((dim > 0 ? dim : 1) * sizeof(int));
+    int top = 0;
+    assert(frames != NULL && st != NULL);
 
-    for (int i = 0; i < graph->vertices; i++)
-        HTAuxiliarySCCInsert(auxiliaryHT, graph->nodes[i].vertex, (TValueHTAuxiliary){NOT_INITIALIZED, NOT_INITIALIZED, false});
+    TSCCs sccs = sccsCreate(dim);
 
-    for (int i = start; i < stop; i++)
+    trimGraph(graph, start, stop, onStack, &sccs);
+
+    #pragma omp parallel for
+    for (int i = 0; i < dim; i++)
     {
+        if (BITSET_TEST(onStack, i))
+            disc[i] = 0;
+    }
 
-        TValueHTAuxiliary *value = HTAuxiliarySCCSearch(auxiliaryHT, graph->nodes[i].vertex);
+    memset(onStack, 0, (BITSET_WORDS(dim) + 1) * sizeof(uint64_t));
 
-        if (value->disc == -1)
+    for (int i = start; i < stop; i++)
+    {
+
+        if (disc[i - start] == NOT_INITIALIZED)
         {
 
-            sccUtil(graph, graph->nodes[i].vertex, auxiliaryHT, &st, &time, start, stop, sccCount, sccs);
+            sccUtil(graph, i, disc, low, onStack, frames, st, &top, &time, start, stop, &sccs);
         }
     }
 
-    HTAuxiliarySCCDestroy(auxiliaryHT);
-    stackDestroy(&st);
+    free(disc);
+    free(low);
+    free(onStack);
+    free(frames);
+    free(st);
 
     return sccs;
-}
\ No newline at end of file
+}
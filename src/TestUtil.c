@@ -153,4 +153,109 @@ void compareResults(Results* res) {
         for(int j = 0; j < res->sequentialResult[i].length; j++)
             assert(res->sequentialResult[i].items[j] == res->parallelResult[i].items[j]);
     }
-}
\ No newline at end of file
+}
+/**
+ * This function reads a labels file written by sccsSaveLabels. The header is read first, and its magic 
+ * string and version are checked against SCCS_LABELS_MAGIC and SCCS_LABELS_VERSION; then the label of every 
+ * vertex identifier is read into a new array, which is returned.
+ * 
+ * @param fileName a string containing the name of the file to be read
+ * @param vertices a pointer to an integer that will be used to store the number of labels
+ * @param components a pointer to an integer that will be used to store the number of SCCs
+ * 
+ * @return an array with the label of every vertex identifier
+*/
+int* readLabels(char* fileName, int* vertices, int* components) {
+
+    FILE* fd = fopen(fileName, "rb");
+    if(fd == NULL) {
+        perror("Error in opening file");
+        exit(1);
+    }
+
+    TSCCsLabelsHeader header;
+    assert(fread(&header, sizeof(header), 1, fd) == 1);
+    assert(memcmp(header.magic, SCCS_LABELS_MAGIC, sizeof(header.magic)) == 0);
+    assert(header.version == SCCS_LABELS_VERSION);
+
+    *vertices = header.vertices;
+    *components = header.components;
+
+    int* label = (int*)malloc(header.vertices * sizeof(int));
+    assert(fread(label, sizeof(int), header.vertices, fd) == (size_t)header.vertices);
+
+    fclose(fd);
+
+    return label;
+}
+
+/**
+ * This function checks that the labels of a labels file define the SCCs read from the output file of the 
+ * same run. The number of SCCs must be the same; every vertex of an SCC must have a label between 0 and 
+ * components - 1, equal to the label of the other vertices of the SCC and different from the labels of the 
+ * other SCCs. Every identifier that is not a vertex of any SCC must be labelled -1.
+ * 
+ * @param label the labels read by readLabels
+ * @param vertices the number of labels
+ * @param components the number of SCCs of the labels file
+ * @param sccs the SCCs read by readResult
+ * @param SCCsNum the number of SCCs read by readResult
+*/
+void checkLabels(int* label, int vertices, int components, TArray* sccs, int SCCsNum) {
+
+    assert(components == SCCsNum);
+
+    bool* used = (bool*)calloc(components, sizeof(bool));
+    bool* seen = (bool*)calloc(vertices, sizeof(bool));
+
+    for(int i = 0; i < SCCsNum; i++) {
+        assert(sccs[i].items[0] >= 0 && sccs[i].items[0] < vertices);
+        int first = label[sccs[i].items[0]];
+        assert(first >= 0 && first < components && !used[first]);
+        used[first] = true;
+        for(int j = 0; j < sccs[i].length; j++) {
+            assert(sccs[i].items[j] >= 0 && sccs[i].items[j] < vertices && label[sccs[i].items[j]] == first);
+            seen[sccs[i].items[j]] = true;
+        }
+    }
+
+    for(int v = 0; v < vertices; v++)
+        assert(seen[v] || label[v] == -1);
+
+    free(used);
+    free(seen);
+}
+
+/**
+ * This function checks that the labels of the sequential and parallel implementations define the same 
+ * partition of the vertices, even if the SCCs are numbered differently: the labels of the two files must be 
+ * -1 for the same identifiers, and the map from the sequential labels to the parallel ones, built while the 
+ * identifiers are scanned, must be a bijection.
+ * 
+ * @param sequential the labels of the sequential implementation
+ * @param parallel the labels of the parallel implementation
+ * @param vertices the number of labels
+ * @param components the number of SCCs
+*/
+void compareLabels(int* sequential, int* parallel, int vertices, int components) {
+
+    int* toParallel = (int*)malloc(components * sizeof(int));
+    int* toSequential = (int*)malloc(components * sizeof(int));
+
+    for(int i = 0; i < components; i++)
+        toParallel[i] = toSequential[i] = -1;
+
+    for(int v = 0; v < vertices; v++) {
+        assert((sequential[v] == -1) == (parallel[v] == -1));
+        if(sequential[v] == -1)
+            continue;
+        if(toParallel[sequential[v]] == -1 && toSequential[parallel[v]] == -1) {
+            toParallel[sequential[v]] = parallel[v];
+            toSequential[parallel[v]] = sequential[v];
+        }
+        assert(toParallel[sequential[v]] == parallel[v] && toSequential[parallel[v]] == sequential[v]);
+    }
+
+    free(toParallel);
+    free(toSequential);
+}
@@ -0,0 +1,208 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file Trim.c
+ * 
+ * @brief Source file for the trimming pre-pass of the algorithms to find the strongly connected 
+ * components (SCCs) of a directed graph. In most graphs many vertices have no incoming or no 
+ * outgoing edge inside the cut, so each of them is an SCC on its own: the pre-pass finds them in 
+ * parallel rounds and records them in bulk, instead of letting them go through the depth-first 
+ * searches of the algorithms one at a time.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <omp.h>
+
+#include "../include/Trim.h"
+
+/**
+ * This function returns the first neighbor of a vertex that is in the cut, has not been removed and is not 
+ * the vertex itself, or -1 if there is none.
+ * 
+ * @param graph The graph
+ * @param vertex The position of the vertex
+ * @param start The start of the cut range
+ * @param stop The end of the cut range
+ * @param removed The bitset of the vertices of the cut already removed
+ * @return The position of the neighbor, or -1
+*/
+static int trimFirstNeighbor(TGraph graph, int vertex, int start, int stop, uint64_t *removed) {
+
+    for(int j = graph->offsets[vertex]; j < graph->offsets[vertex + 1]; j++) {
+        int t = graph->targets[j];
+        if(t != vertex && isInCut(t, start, stop) && !BITSET_TEST(removed, t - start))
+            return t;
+    }
+
+    return -1;
+}
+
+/**
+ * This function removes from a cut of a graph the vertices that are trivially strongly connected components. 
+ * Only the edges between vertices of the cut that have not been removed are considered, and self loops are 
+ * ignored. The function keeps the list of the vertices not removed yet and repeats the following steps, for at 
+ * most TRIM_MAX_ROUNDS rounds:
+ * 
+ *  1. In parallel, for every vertex of the list it counts its outgoing edges and, with an atomic increment, 
+ *     the incoming edges of their destinations.
+ *  2. Every vertex with in-degree or out-degree 0 cannot be part of a cycle, so it is removed and appended to 
+ *     the list of the trimmed vertices, while the other vertices are kept in the list.
+ *  3. When a round removes no vertex, the function looks in parallel for pairs of vertices u and v such that 
+ *     the only outgoing edge of u goes to v and the only outgoing edge of v goes to u: nothing else can be 
+ *     reached from them, so they form an SCC of size 2. Every pair found is recorded as an SCC and removed, 
+ *     and the rounds start again, since removing the pairs lowers the degrees of their neighbors.
+ * 
+ * Finally, every trimmed vertex is recorded in parallel as an SCC with a single vertex. The removed vertices 
+ * are marked in a bitset, indexed by the position of the vertex minus the start of the cut, so that the 
+ * algorithm can skip them.
+ * 
+ * @param graph The graph
+ * @param start The start of the cut range
+ * @param stop The end of the cut range
+ * @param removed A cleared bitset with a bit for every vertex of the cut, where the removed vertices are marked
+ * @param sccs The set where the SCCs found are stored
+ * @return The number of vertices removed
+*/
+int trimGraph(TGraph graph, int start, int stop, uint64_t *removed, TSCCs *sccs) {
+
+    int dim = stop - start;
+    int size = dim > 0 ? dim : 1;
+    int *inDegree = (int *) malloc(size * sizeof(int));
+    int *outDegree = (int *) malloc(size * sizeof(int));
+    int *active = (int *) malloc(size * sizeof(int));
+    int *trimmed = (int *) malloc(size * sizeof(int));
+    assert(inDegree != NULL && outDegree != NULL && active != NULL && trimmed != NULL);
+
+    int length = dim, count = 0, paired = 0;
+
+    #pragma omp parallel for
+    for(int i = 0; i < dim; i++)
+        active[i] = start + i;
+
+    for(int round = 0; round < TRIM_MAX_ROUNDS && length > 0; round++) {
+
+        #pragma omp parallel for
+        for(int i = 0; i < length; i++)
+            inDegree[active[i] - start] = 0;
+
+        #pragma omp parallel for schedule(dynamic, 1024)
+        for(int i = 0; i < length; i++) {
+            int v = active[i], degree = 0;
+            for(int j = graph->offsets[v]; j < graph->offsets[v + 1]; j++) {
+                int t = graph->targets[j];
+                if(t != v && isInCut(t, start, stop) && !BITSET_TEST(removed, t - start)) {
+                    degree++;
+                    __sync_fetch_and_add(&inDegree[t - start], 1);
+                }
+            }
+            outDegree[v - start] = degree;
+        }
+
+        int kept = 0, before = count;
+        for(int i = 0; i < length; i++) {
+            int v = active[i];
+            if(inDegree[v - start] == 0 || outDegree[v - start] == 0) {
+                trimmed[count++] = v;
+                BITSET_SET(removed, v - start);
+            } else 
+                active[kept++] = v;
+        }
+        length = kept;
+
+        if(count > before)
+            continue;
+
+        int pairs = 0;
+        int *partners = inDegree;
+
+        #pragma omp parallel for
+        for(int i = 0; i < length; i++) {
+            int u = active[i];
+            if(outDegree[u - start] != 1)
+                continue;
+            int v = trimFirstNeighbor(graph, u, start, stop, removed);
+            if(v > u && outDegree[v - start] == 1 && trimFirstNeighbor(graph, v, start, stop, removed) == u) {
+                int slot = __sync_fetch_and_add(&pairs, 1);
+                partners[2 * slot] = u;
+                partners[2 * slot + 1] = v;
+            }
+        }
+
+        if(pairs == 0)
+            break;
+
+        for(int i = 0; i < pairs; i++) {
+            int u = partners[2 * i], v = partners[2 * i + 1];
+            BITSET_SET(removed, u - start);
+            BITSET_SET(removed, v - start);
+            int *pair = sccsAppend(sccs, 2);
+            pair[0] = graph->ids[u];
+            pair[1] = graph->ids[v];
+        }
+        paired += 2 * pairs;
+
+        kept = 0;
+        for(int i = 0; i < length; i++)
+            if(!BITSET_TEST(removed, active[i] - start))
+                active[kept++] = active[i];
+        length = kept;
+    }
+
+    int *singletons = sccsAppendSingletons(sccs, count);
+
+    #pragma omp parallel for
+    for(int i = 0; i < count; i++)
+        singletons[i] = graph->ids[trimmed[i]];
+
+    free(inDegree);
+    free(outDegree);
+    free(active);
+    free(trimmed);
+
+    return count + paired;
+}
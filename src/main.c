@@ -52,55 +52,39 @@
 #include <stdlib.h>
 #include <mpi.h>
 #include <omp.h>
-#include <sys/resource.h>
 #include <time.h>
 
 #include "../include/TGraph.h"
 #include "../include/Tarjan.h"
 #include "../include/Kosaraju.h"
+#include "../include/Pearce.h"
+#include "../include/FWBW.h"
+#include "../include/Coloring.h"
+#include "../include/Multistep.h"
 #include "../include/THTSCCs.h"
 #include "../include/THTAuxiliaryGraph.h"
 #include "../include/DebugPrintUtils.h"
 #include "../include/Utils.h"
+#include "../include/Communication.h"
 
 int main(int argc, char **argv) {
 
-/**
- * Setting the Stack Memory Limit 
- * 
- * This code snippet sets the stack memory limit for the current process to an infinite limit. 
- * It does this by first creating a struct rlimit , which contains two fields - rlim_cur and 
- * rlim_max - that hold the soft and hard limits, respectively. The soft and hard limits are 
- * then set to RLIM_INFINITY using the rlim object. Finally, the setrlimit function is called 
- * with the RLIMIT_STACK constant and the rlim object, which sets the stack memory limit to an 
- * infinite limit. If an error occurs, the perror function is called with the string "setrlimit" 
- * and return 1 is called.
-*/
-    struct rlimit rlim;
-
-    rlim.rlim_cur = RLIM_INFINITY;
-    rlim.rlim_max = RLIM_INFINITY;
-
-    if (setrlimit(RLIMIT_STACK, &rlim) < 0) {
-        perror("setrlimit");
-        return 1;
-    }
-
 /**
  * The program checks for the presence of the PARALLEL macro, which indicates that the program is 
  * being compiled for parallel execution. If PARALLEL is defined, the program checks that the correct 
  * number of command-line arguments were passed (2 arguments, the number of OpenMP threads and the name 
- * of the input file). If the arguments are not correct, the program prints an error message and exits.
+ * of the input file, optionally followed by the name of a labels file). If the arguments are not correct, 
+ * the program prints an error message and exits.
  */
 #ifdef PARALLEL
 
 /**
  * This block of code checks if the program was compiled with OpenMP support and checks for the correct 
- * number of command line arguments. If the number of arguments is not equal to 3, it prints a usage 
+ * number of command line arguments. If the number of arguments is not equal to 3 or 4, it prints a usage 
  * message and exits with a failure code.
 */
-    if(argc != 3){
-        fprintf(stderr, "Usage:\n\t%s [ompNumThreads] [fileName]\n", argv[0]);
+    if(argc != 3 && argc != 4){
+        fprintf(stderr, "Usage:\n\t%s [ompNumThreads] [fileName] [labelsFileName]\n", argv[0]);
 		exit(EXIT_FAILURE);
     }
 
@@ -110,12 +94,8 @@ int main(int argc, char **argv) {
 */
     omp_set_num_threads(atoi(argv[1]));
 
-    int cutGraphSize, 
-        remainder, 
-        start, 
+    int start, 
         stop,
-        sccCount = 0,
-        offset = 0,
         MPIProcesses;
     
     double itime = 0,
@@ -132,75 +112,109 @@ int main(int argc, char **argv) {
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
     MPI_Comm_size(MPI_COMM_WORLD, &size);
 
-    if(rank == size - 1) 
+    if(rank == 0) 
         MPIProcesses = size;
 
 /**
- * The program then creates a graph from the file name given as the second command line argument.
+ * The program then reads the partition of the graph owned by the rank from the file name given as the 
+ * second command line argument. The graph is split in size parts with roughly the same number of edges 
+ * and vertices, chosen at load time by popolateGraphPartition: each rank only reads and holds its own 
+ * vertices, and their neighbors owned by the other ranks are kept as ghosts, so the memory used by a rank 
+ * shrinks as the number of ranks grows. 
+ * The appropriate algorithm, chosen at compile time among Tarjan's Algorithm, Kosaraju's Algorithm, 
+ * Pearce's Algorithm, the Forward-Backward Algorithm, the coloring Algorithm and the Multistep pipeline, 
+ * is then run on all the vertices of the partition, since the ghosts are never in the cut.
  */
-    TGraph graph = popolateGraph(argv[2]);
+    TGraph graph = popolateGraphPartition(argv[2], rank, size);
 
-/**
- * This line stores the number of vertices in the graph.
- */
-    int vertices = graph->vertices;
+    start = 0;
+    stop = graph->vertices;
 
 /**
- * This line stores the number of vertices in the graph.
+ * These lines store the largest identifier of the vertices of the whole graph, which is used to give the 
+ * macronodes identifiers distinct from the ones of the vertices.
  */
-    int ultimo = graph->nodes[graph->vertices - 1].vertex;
+    int ultimo,
+        localUltimo = graph->vertices > 0 ? graph->ids[graph->vertices - 1] : -1;
+
+    MPI_Allreduce(&localUltimo, &ultimo, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
 
 /**
- * This code works by first dividing the graph into size parts. Each rank is assigned a portion of 
- * the graph, which is then passed to the appropriate algorithm. The two algorithms used are Tarjan's 
- * Algorithm and Kosaraju's Algorithm. The code then determines the start and stop values for each rank. 
- * If the rank is less than the remainder, it is assigned an extra vertex, otherwise it is assigned the 
- * same number of vertices as every other rank.
+ * The ifndef TEST statement is used to print on the standard error, from rank 0, the number of vertices 
+ * and edges of every partition and its imbalance ratio, that is its cost divided by the mean cost of the 
+ * partitions, where the cost is the same balanced by graphPartitionRange. The last line reports the 
+ * largest ratio, which bounds the time of the local phase.
  */
-    cutGraphSize = graph->vertices / size;
-    remainder = graph->vertices % size;
-
-    if(rank < remainder) {
-        start = rank * (cutGraphSize + 1); 
-        stop = start + cutGraphSize + 1;
-    } else {
-        start = rank * cutGraphSize + remainder;  
-        stop = start + cutGraphSize;
-    }
+    #ifndef TEST
+        int partition[2] = {graph->vertices, graph->edges};
+        int *partitions = rank == 0 ? (int *) malloc(2 * size * sizeof(int)) : NULL;
+
+        MPI_Gather(partition, 2, MPI_INT, partitions, 2, MPI_INT, 0, MPI_COMM_WORLD);
+
+        if(rank == 0) {
+            double mean = 0, imbalance = 0;
+            for(int i = 0; i < size; i++)
+                mean += (double) GRAPH_PARTITION_VERTEX_WEIGHT * partitions[2 * i] + partitions[2 * i + 1];
+            mean /= size;
+            for(int i = 0; i < size; i++) {
+                double ratio = mean > 0 ? ((double) GRAPH_PARTITION_VERTEX_WEIGHT * partitions[2 * i] + partitions[2 * i + 1]) / mean : 1;
+                fprintf(stderr, "Rank %d: %d vertices, %d edges, imbalance %.3f\n", i, partitions[2 * i], partitions[2 * i + 1], ratio);
+                if(ratio > imbalance)
+                    imbalance = ratio;
+            }
+            fprintf(stderr, "Partition imbalance: %.3f\n", imbalance);
+            free(partitions);
+        }
+    #endif
 
 /**
  * The appropriate algorithm is then called on the assigned portion of the graph, and the results are stored 
- * in an array called sccs. Finally, the time taken to find the SCCs is stored.
+ * in a set called sccs, which keeps all the SCCs in two flat arrays. Finally, the time taken to find the SCCs 
+ * is stored.
 */
-    TArray* sccs;
+    TSCCs sccs;
 
-    if(rank == size - 1) itime = MPI_Wtime();
+    if(rank == 0) itime = MPI_Wtime();
 
     #ifdef TARJAN
-        sccs = scc(graph, start, stop, &sccCount);
+        sccs = scc(graph, start, stop);
     #endif
 
     #ifdef KOSARAJU
-        sccs = kosaraju(graph, start, stop, &sccCount);
+        sccs = kosaraju(graph, start, stop);
     #endif
 
-    if(rank == size - 1) sccs_time += (MPI_Wtime() - itime);
+    #ifdef PEARCE
+        sccs = pearce(graph, start, stop);
+    #endif
+
+    #ifdef FWBW
+        sccs = fwbw(graph, start, stop);
+    #endif
+
+    #ifdef COLORING
+        sccs = coloring(graph, start, stop);
+    #endif
+
+    #ifdef MULTISTEP
+        sccs = multistep(graph, start, stop);
+    #endif
+
+    if(rank == 0) sccs_time += (MPI_Wtime() - itime);
 
 /**
  * The next part of the code contains several variables: 
- *  - sizeBuffer and rcvSizeBuffer: both of type int, used to store the size of the buffers. 
- *  - buffer and rcvBuffer: both of type int*, used to store buffers. 
+ *  - sizeBuffer: of type int, used to store the size of the buffers. 
+ *  - buffer and rcvBuffer: both of type int*, used to store the buffers sent and received. 
  *  - color: of type int, used to store the color assigned to the process. 
  *  - COMM: of type MPI_Comm, used to store the MPI_Comm_WORLD communicator. 
  *  - NEW_COMM: of type MPI_Comm, used to store a new communicator. 
  *  - sccsHT: of type THTSCCs, used to store a hash table of strongly connected components. 
  *  - auxiliaryGraphHT: of type THTAuxiliaryGraph, used to store a hash table in order to compute 
  *    a new graph. 
- *  - oldGraph: of type TGraph, used to store the old graph. 
- *  - rvdGraph: of type TGraph, used to store the received graph.
+ *  - nextId: the first id of the macronodes not reserved yet, which is the same on every rank. 
 */
-    int sizeBuffer,
-        rcvSizeBuffer;
+    int sizeBuffer;
     int *buffer,
         *rcvBuffer;
 
@@ -212,165 +226,223 @@ int main(int argc, char **argv) {
     THTSCCs* sccsHT = HTSCCsCreate(graph->vertices / 2);
     THTAuxiliaryGraph* auxiliaryGraphHT = HTAuxiliaryGraphCreate(graph->vertices / 2);
 
-    TGraph oldGraph = NULL, rvdGraph = NULL;
+    int nextId = ultimo + 1;
 
 /**
- * At this point each process has its own SCC based on the portion of the graph that has been assigned to it. As a result, 
- * the inter-process communication process begins. In particular, while the number of processes is greater than 1, the 
- * process with even rank sends to the process with the following rank the closely connected components found, the hash 
- * table 'sccsHT' which has the name of a macronode as key and as value the strictly connected components that compose it, 
- * the hash table 'auxiliaryGraphHT' which has as key the name of a vertex and as value the name of the macronode to which 
- * it belongs and the graph of the previous iteration. In particular, during the first iteration, the two tables hash and 
- * oldGraph are empty. The process with odd rank, on the other hand, receives this information from the process with previous 
- * rank and adds it to its own. At this point, based on the information received, the process proceeds with the creation of a 
- * new graph, which is then passed to the 'scc' or 'kosaraju' method to find the strictly connected components. Finally, based 
- * on the value of the 'color' value (0 for processes with rank even and that sent the information and 1 for all others), a 
- * new communicator is created, and processes with color equal to 0 are eliminated. The old communicator is then updated, the 
- * number of iterations is updated and we proceed with the next iteration. 
+ * At this point each process has its own SCCs based on the portion of the graph that has been assigned to it. As a result, 
+ * the inter-process communication process begins. While the number of processes is greater than 1, every round works as 
+ * follows:
+ *  1. Every process condenses its own graph: each SCC with more than one vertex becomes a macronode, whose id is taken from 
+ *     a block of ids reserved with an exclusive prefix sum over the processes, so that the ids never collide. The macronode 
+ *     is stored in the hash table 'sccsHT', which has the name of a macronode as key and as value the vertices that compose 
+ *     it, and every vertex of the SCC is stored in the hash table 'auxiliaryGraphHT', which has as key the name of a vertex 
+ *     and as value the name of the macronode to which it belongs. The new graph is then built by 'createNewGraph'. Since 
+ *     every process condenses its own graph, this work is spread over all the processes of the round.
+ *  2. The processes are split in groups of MERGE_FAN_IN consecutive ranks. Every process of a group, except the first one, 
+ *     sends to the first one its condensed graph and its two hash tables, and leaves the computation. A process on the 
+ *     same node as the first one of its group copies them in its segment of a shared memory window, where the first 
+ *     process reads them in place. The other ones send the CSR arrays of the graph and the two serialized hash tables 
+ *     as streams of nonblocking chunks (see Communication.h), compressed when they are larger than 
+ *     COMM_COMPRESSION_THRESHOLD integers (see Compression.h), and the first process keeps a receive posted for every 
+ *     stream of the group: the arrays of the graph are received directly into a new graph, while each hash table is 
+ *     deserialized as soon as it is complete, when the chunks of the other streams keep arriving. With a fan-in of 2 
+ *     this is the classic pairwise merge tree, while with a fan-in not smaller than the number of processes all the 
+ *     processes send to rank 0 at once: larger fan-ins need fewer rounds.
+ *  3. The first process of every group adds the hash tables received to its own ones and merges the condensed graphs with 
+ *     'mergeGraphs', which only has to resolve the edges crossing the processes of the group. The merged graph is then 
+ *     passed to the 'scc', 'kosaraju', 'pearce', 'fwbw', 'coloring' or 'multistep' method to find the strictly connected 
+ *     components. 
+ * Finally, based on the value of the 'color' value (0 for the processes that sent their graph and 1 for the first process 
+ * of every group), a new communicator is created, and processes with color equal to 0 are eliminated. The old communicator 
+ * is then updated, the number of iterations is updated and we proceed with the next iteration. Rank 0 is always the first 
+ * process of its group, so it is the one holding the result at the end, and it measures the time spent finding the SCCs 
+ * and the time spent merging them.
  */
     int numIteration = 1; 
     while(size > 1) {
 
-        if(rank % 2 == 0) {
-            color = 1;
-            if(rank + 1 < size) {
-                
-                if(rank == 0) itime = MPI_Wtime();
-                buffer = serializeSCCs(sccs, sccCount, &sizeBuffer);
-                MPI_Send(&sizeBuffer, 1, MPI_INT, rank + 1, 0, COMM);
-                MPI_Send(buffer, sizeBuffer, MPI_INT, rank + 1, 0, COMM);
-                free(buffer);
+        if(rank == 0) itime = MPI_Wtime();
+
+        int macronodes = 0,
+            first = 0,
+            reserved = 0,
+            offset = 0;
+
+        for(int i = 0; i < sccs.count; i++)
+            if(sccs.offsets[i + 1] - sccs.offsets[i] > 1)
+                macronodes++;
+
+        MPI_Exscan(&macronodes, &first, 1, MPI_INT, MPI_SUM, COMM);
+        MPI_Allreduce(&macronodes, &reserved, 1, MPI_INT, MPI_SUM, COMM);
+        if(rank == 0) 
+            first = 0;
+
+        int* nodes = (int*)malloc((sccs.count + 1) * sizeof(int)); 
+        for(int i = 0; i < sccs.count; i++) {
+            int *members = &sccs.vertices[sccs.offsets[i]];
+            int len = sccs.offsets[i + 1] - sccs.offsets[i];
+            if(len > 1) {
+                int id = calculateId(nextId + first, &offset);
+                nodes[i] = id;
+                TArray tmp = arrayCreate(0, false); 
+                arrayReserve(&tmp, len);
+                arrayAppendN(&tmp, members, len);
+                for(int j = 0; j < len; j++)
+                    HTAuxiliaryGraphInsert(auxiliaryGraphHT, members[j], id);
+                HTSCCsInsert(sccsHT, id, tmp);
+            } else {
+                nodes[i] = members[0];
+            }
+        }
+        nextId += reserved;
+
+        TGraph newGraph = createNewGraph(graph, &sccs, nodes, auxiliaryGraphHT);
+        graphDestroy(graph);
+        graph = newGraph;
+
+        free(nodes);
+        sccsDestroy(&sccs);
+
+        int leader = rank - rank % MERGE_FAN_IN;
+
+        TSharedSegment shared = sharedSegmentCreate(COMM);
+
+        if(rank != leader) {
+            color = 0;
+
+            if(sharedSegmentIsLocal(&shared, leader)) {
+                int *sccsBuffer,
+                    *auxiliaryBuffer,
+                    sccsSize,
+                    auxiliarySize;
+
+                sccsBuffer = serializeSCCsHT(sccsHT, &sccsSize);
+                auxiliaryBuffer = serializeAuxiliaryGraphHT(auxiliaryGraphHT, &auxiliarySize);
+                sharedSegmentPublish(&shared, graph, sccsBuffer, sccsSize, auxiliaryBuffer, auxiliarySize);
+                free(sccsBuffer);
+                free(auxiliaryBuffer);
+
+            } else {
+                TChunkedSend pending = chunkedSendCreate();
+
+                sharedSegmentPublish(&shared, NULL, NULL, 0, NULL, 0);
+
+                chunkedSendGraph(&pending, graph, leader, COMM);
 
                 buffer = serializeSCCsHT(sccsHT, &sizeBuffer);
-                MPI_Send(&sizeBuffer, 1, MPI_INT, rank + 1, 0, COMM);
-                if(sizeBuffer != 1)
-                    MPI_Send(buffer, sizeBuffer, MPI_INT, rank + 1, 0, COMM);
-                free(buffer);
+                chunkedSendPayload(&pending, buffer, sizeBuffer, leader, COMM_TAG_SCCS_HT, COMM);
 
                 buffer = serializeAuxiliaryGraphHT(auxiliaryGraphHT, &sizeBuffer);
-                MPI_Send(&sizeBuffer, 1, MPI_INT, rank + 1, 0, COMM);
-                if(sizeBuffer != 1)
-                    MPI_Send(buffer, sizeBuffer, MPI_INT, rank + 1, 0, COMM);
-                free(buffer);
-
-                if(numIteration > 1) {
-                    buffer = serializeGraph(&oldGraph, &sizeBuffer);
-                    MPI_Send(&sizeBuffer, 1, MPI_INT, rank + 1, 0, COMM);
-                    MPI_Send(buffer, sizeBuffer, MPI_INT, rank + 1, 0, COMM);
-                    free(buffer);
-                }
-                
-                if(rank == 0) comm_time += (MPI_Wtime() - itime);
-                color = 0;
+                chunkedSendPayload(&pending, buffer, sizeBuffer, leader, COMM_TAG_AUXILIARY_GRAPH_HT, COMM);
+
+                chunkedSendWait(&pending);
             }
+
+            sharedSegmentDestroy(&shared);
+
         } else {
-            
             color = 1;
 
-            MPI_Recv(&rcvSizeBuffer, 1, MPI_INT, rank - 1, 0, COMM, MPI_STATUS_IGNORE);
-            rcvBuffer = malloc(rcvSizeBuffer * sizeof(int));
-            MPI_Recv(rcvBuffer, rcvSizeBuffer, MPI_INT, rank - 1, 0, COMM, MPI_STATUS_IGNORE);
-
-            if(rank == size - 1) itime = MPI_Wtime();
-            deserializeSCCs(sccs, rcvBuffer, rcvSizeBuffer, &sccCount);
-            if(rank == size - 1) comm_time += (MPI_Wtime() - itime);
-            free(rcvBuffer);
-
-            MPI_Recv(&rcvSizeBuffer, 1, MPI_INT, rank - 1, 0, COMM, MPI_STATUS_IGNORE);
-            if(rcvSizeBuffer != 1) {
-                rcvBuffer = malloc(rcvSizeBuffer * sizeof(int));
-                MPI_Recv(rcvBuffer, rcvSizeBuffer, MPI_INT, rank - 1, 0, COMM, MPI_STATUS_IGNORE);
-                if(rank == size - 1) itime = MPI_Wtime();
-                deserializeSCCsHT(sccsHT, rcvBuffer);
-                if(rank == size - 1) comm_time += (MPI_Wtime() - itime);
-                free(rcvBuffer);
+            int members = min(rank + MERGE_FAN_IN, size) - rank;
+            TGraph* graphs = (TGraph*)malloc(members * sizeof(TGraph));
+            bool* local = (bool*)calloc(members, sizeof(bool));
+            graphs[0] = graph;
+
+            sharedSegmentPublish(&shared, NULL, NULL, 0, NULL, 0);
+
+            int streamCount = (members - 1) * COMM_STREAMS;
+            TChunkedRecv* streams = (TChunkedRecv*)malloc((streamCount + 1) * sizeof(TChunkedRecv));
+            MPI_Request* requests = (MPI_Request*)malloc((streamCount + 1) * sizeof(MPI_Request));
+
+            for(int m = 1; m < members; m++) {
+                TChunkedRecv* memberStreams = &streams[(m - 1) * COMM_STREAMS];
+                MPI_Request* memberRequests = &requests[(m - 1) * COMM_STREAMS];
+                for(int tag = 0; tag < COMM_STREAMS; tag++)
+                    memberRequests[tag] = MPI_REQUEST_NULL;
+                if(sharedSegmentIsLocal(&shared, rank + m)) {
+                    local[m] = true;
+                    continue;
+                }
+                chunkedRecvStart(&memberStreams[COMM_TAG_GRAPH], &memberRequests[COMM_TAG_GRAPH], rank + m, COMM_TAG_GRAPH, COMM);
+                chunkedRecvStart(&memberStreams[COMM_TAG_SCCS_HT], &memberRequests[COMM_TAG_SCCS_HT], rank + m, COMM_TAG_SCCS_HT, COMM);
+                chunkedRecvStart(&memberStreams[COMM_TAG_AUXILIARY_GRAPH_HT], &memberRequests[COMM_TAG_AUXILIARY_GRAPH_HT], rank + m, COMM_TAG_AUXILIARY_GRAPH_HT, COMM);
             }
 
-            MPI_Recv(&rcvSizeBuffer, 1, MPI_INT, rank - 1, 0, COMM, MPI_STATUS_IGNORE);
-            if(rcvSizeBuffer != 1) {
-                rcvBuffer = malloc(rcvSizeBuffer * sizeof(int));
-                MPI_Recv(rcvBuffer, rcvSizeBuffer, MPI_INT, rank - 1, 0, COMM, MPI_STATUS_IGNORE);
-                if(rank == size - 1) itime = MPI_Wtime();
-                deserializeAuxiliaryGraphHT(auxiliaryGraphHT, rcvBuffer);
-                if(rank == size - 1) comm_time += (MPI_Wtime() - itime);
-                free(rcvBuffer);
+            for(int m = 1; m < members; m++) {
+                if(local[m]) {
+                    int *sccsBuffer,
+                        *auxiliaryBuffer;
+                    graphs[m] = sharedSegmentGraph(&shared, rank + m, &sccsBuffer, &auxiliaryBuffer);
+                    deserializeSCCsHT(sccsHT, sccsBuffer);
+                    deserializeAuxiliaryGraphHT(auxiliaryGraphHT, auxiliaryBuffer);
+                }
             }
 
-            if(numIteration > 1) {
-                MPI_Recv(&rcvSizeBuffer, 1, MPI_INT, rank - 1, 0, COMM, MPI_STATUS_IGNORE);
-                rcvBuffer = malloc(rcvSizeBuffer * sizeof(int));
-                MPI_Recv(rcvBuffer, rcvSizeBuffer, MPI_INT, rank - 1, 0, COMM, MPI_STATUS_IGNORE);
-                if(rank == size - 1) itime = MPI_Wtime();
-                rvdGraph = deserializeGraph(rcvBuffer, rcvSizeBuffer);
-                if(rank == size - 1) comm_time += (MPI_Wtime() - itime);
-                free(rcvBuffer);
+            int index;
+            while((index = chunkedRecvWaitAny(streams, requests, streamCount)) != MPI_UNDEFINED) {
+                int base = index - index % COMM_STREAMS;
+                rcvBuffer = streams[index].buffer;
+
+                if(streams[index].tag == COMM_TAG_GRAPH)
+                    graphs[streams[index].source - rank] = chunkedRecvGraph(&streams[base], &requests[base]);
+                else if(streams[index].tag == COMM_TAG_SCCS_HT) {
+                    deserializeSCCsHT(sccsHT, rcvBuffer);
+                    free(rcvBuffer);
+                } else if(streams[index].tag == COMM_TAG_AUXILIARY_GRAPH_HT) {
+                    deserializeAuxiliaryGraphHT(auxiliaryGraphHT, rcvBuffer);
+                    free(rcvBuffer);
+                }
             }
 
-            if(rank == size - 1) itime = MPI_Wtime();
-            int* nodes = (int*)malloc(sccCount * sizeof(int)); 
-            int i, j;
-            for(i = 0; i < sccCount; i++) {
-                int len = sccs[i].length;
-                if(len > 1) {
-                    int id = calculateId((rank+1)*size, vertices, ultimo*numIteration, &offset);
-                    nodes[i] = id;
-                    TArray tmp = arrayCreate(0, false); 
-                    for(j = 0; j < len; j++) {
-                        int key = sccs[i].items[j];
-                        HTAuxiliaryGraphInsert(auxiliaryGraphHT, key, id);
-                        arrayAdd(&tmp, key);
-                    }
-                    HTSCCsInsert(sccsHT, id, tmp);
-                } else {
-                    nodes[i] = sccs[i].items[0];
+            free(streams);
+            free(requests);
+
+            if(members > 1) {
+                graph = mergeGraphs(graphs, members, auxiliaryGraphHT);
+                for(int m = 0; m < members; m++) {
+                    if(local[m])
+                        free(graphs[m]);
+                    else
+                        graphDestroy(graphs[m]);
                 }
             }
-            
-            TGraph newGraph = graphCreate(sccCount);
+            free(graphs);
+            free(local);
 
-            createNewGraph(&graph, &oldGraph, &newGraph, &rvdGraph, sccsHT, auxiliaryGraphHT, nodes, sccCount, numIteration);
+            sharedSegmentDestroy(&shared);
 
-            if(rank == size - 1) comm_time += (MPI_Wtime() - itime);
-            
-            if(numIteration > 1)
-                graphDestroy(oldGraph);
+            if(rank == 0) comm_time += (MPI_Wtime() - itime);
 
-            oldGraph = newGraph;
+            if(rank == 0) itime = MPI_Wtime();
 
-            free(nodes);
-
-            qsort(oldGraph->nodes, oldGraph->vertices, sizeof(Node), compare);
+            #ifdef TARJAN
+                sccs = scc(graph, 0, graph->vertices);
+            #endif
 
-            for(int i = 0; i < sccCount; i++) 
-                arrayDestroy(&sccs[i]);
-            free(sccs);
+            #ifdef KOSARAJU
+                sccs = kosaraju(graph, 0, graph->vertices);
+            #endif
 
-            if(rank == size - 1) itime = MPI_Wtime();
+            #ifdef PEARCE
+                sccs = pearce(graph, 0, graph->vertices);
+            #endif
 
-            #ifdef TARJAN
-                sccs = scc(oldGraph, 0, oldGraph->vertices, &sccCount);
+            #ifdef FWBW
+                sccs = fwbw(graph, 0, graph->vertices);
             #endif
 
-            #ifdef KOSARAJU
-                sccs = kosaraju(oldGraph, 0, oldGraph->vertices, &sccCount);
+            #ifdef COLORING
+                sccs = coloring(graph, 0, graph->vertices);
             #endif
 
-            if(rank == size - 1) sccs_time += (MPI_Wtime() - itime);
+            #ifdef MULTISTEP
+                sccs = multistep(graph, 0, graph->vertices);
+            #endif
 
-        }
+            if(rank == 0) sccs_time += (MPI_Wtime() - itime);
 
-        if(size == 2 && rank == 0) {
-            MPI_Send(&sccs_time, 1, MPI_DOUBLE, 1, 0, COMM);
-            MPI_Send(&comm_time, 1, MPI_DOUBLE, 1, 0, COMM);
-        } else if(size == 2 && rank == 1){
-            double rcvTarjanTime, rcvCommTime;
-            MPI_Recv(&rcvTarjanTime, 1, MPI_DOUBLE, 0, 0, COMM, MPI_STATUS_IGNORE);
-            MPI_Recv(&rcvCommTime, 1, MPI_DOUBLE, 0, 0, COMM, MPI_STATUS_IGNORE);
-            sccs_time += rcvTarjanTime;
-            comm_time += rcvCommTime;
         }
 
-        MPI_Barrier(COMM);
         MPI_Comm_split(COMM, color, rank, &NEW_COMM);
         MPI_Comm_rank(NEW_COMM, &rank);
         MPI_Comm_size(NEW_COMM, &size);
@@ -379,11 +451,9 @@ int main(int argc, char **argv) {
             HTSCCsDestroy(sccsHT);
             HTAuxiliaryGraphDestroy(auxiliaryGraphHT);
             graphDestroy(graph);
-            if(oldGraph != NULL) graphDestroy(oldGraph);
-            if(rvdGraph != NULL) graphDestroy(rvdGraph);
-            for(int i = 0; i < sccCount; i++) 
-                arrayDestroy(&sccs[i]);
-            free(sccs);
+            MPI_Comm_free(&NEW_COMM);
+            if(numIteration > 1)
+                MPI_Comm_free(&COMM);
             MPI_Finalize();
             return 0;
         }
@@ -401,25 +471,36 @@ int main(int argc, char **argv) {
  * This code snippet is mainly responsible for cleaning up the memory used in the program. It handles 
  * deallocating the memory used by the program and shutting down the MPI processes.
  * The ifndef TEST statement is used to print out the number of MPI processes, the time taken to run 
- * the SCCs, the communication time and the total time taken.
+ * the SCCs, the communication time and the total time taken. The Multistep pipeline also prints the time 
+ * spent in its trimming, FW-BW, coloring and Tarjan phases.
  * The ifdef TEST statement is used to print the SCCs to a file for testing purposes.
+ * If the name of a labels file was given, the index of the SCC of every vertex of the original graph is 
+ * written to it in binary form by sccsSaveLabels, after the macronodes have been expanded by sccsLabel.
 */
-    #ifndef TEST
+    #if !defined(TEST) && !defined(MULTISTEP)
         printf("%d,%f,%f,%f\n", MPIProcesses, sccs_time, comm_time, sccs_time + comm_time);
     #endif
 
+    #if !defined(TEST) && defined(MULTISTEP)
+        printf("%d,%f,%f,%f,%f,%f,%f,%f\n", MPIProcesses, sccs_time, comm_time, sccs_time + comm_time, 
+            multistepTimes.trim, multistepTimes.fwbw, multistepTimes.coloring, multistepTimes.tarjan);
+    #endif
+
     #ifdef TEST
-        printSCCsOnFile(sccCount, sccs, graph->vertices, sccsHT, "../test/SCCParOut.txt");
+        printSCCsOnFile(&sccs, ultimo + 1, sccsHT, "../test/SCCParOut.txt");
     #endif
 
+    if(argc == 4) {
+        int *label = (int *) malloc((ultimo + 2) * sizeof(int));
+        sccsLabel(&sccs, ultimo + 1, sccsHT, label);
+        sccsSaveLabels(label, ultimo + 1, sccs.count, argv[3]);
+        free(label);
+    }
+
     HTSCCsDestroy(sccsHT);
     HTAuxiliaryGraphDestroy(auxiliaryGraphHT);
     graphDestroy(graph);
-    if(oldGraph != NULL) graphDestroy(oldGraph);
-    if(rvdGraph != NULL) graphDestroy(rvdGraph);
-    for(int i = 0; i < sccCount; i++) 
-        arrayDestroy(&sccs[i]);
-    free(sccs);
+    sccsDestroy(&sccs);
 
     MPI_Finalize();
     return 0;
@@ -430,51 +511,78 @@ int main(int argc, char **argv) {
  * Sequential Algorithm for Finding Strongly Connected Components
  * 
  * This code implements an algorithm for finding the strongly connected components of a directed 
- * graph using either Tarjan's or Kosaraju's algorithms.
- * The program takes one argument: the filename of the graph to analyze. It begins by populating 
+ * graph using either Tarjan's, Kosaraju's, Pearce's, the Forward-Backward or the coloring algorithms, or the Multistep pipeline.
+ * The program takes one argument: the filename of the graph to analyze, optionally followed by the name 
+ * of a labels file, where the index of the SCC of every vertex is written in binary form. It begins by populating 
  * the graph based on the provided filename. It then proceeds to detect the strongly connected 
- * components in the graph using either Tarjan's or Kosaraju's algorithms, depending on which is 
- * specified in the #ifdef statement. The program will then record the elapsed time it took to 
- * compute the strongly connected components and output it to the terminal. If a 'TEST' flag is set, 
+ * components in the graph using either Tarjan's, Kosaraju's, Pearce's, the Forward-Backward or the coloring algorithms, or the Multistep pipeline, 
+ * depending on which is specified in the #ifdef statement. The program will then record the elapsed 
+ * time it took to compute the strongly connected components and output it to the terminal. If a 'TEST' flag is set, 
  * the program will output the strongly connected components to a file. Lastly, the program will free 
  * the memory allocated for the strongly connected components and destroy the graph.
 */
 #ifdef SEQUENTIAL
 
-    if(argc != 2){
-        fprintf(stderr, "Usage:\n\t%s [fileName]\n", argv[0]);
+    if(argc != 2 && argc != 3){
+        fprintf(stderr, "Usage:\n\t%s [fileName] [labelsFileName]\n", argv[0]);
         exit(EXIT_FAILURE);
     }
 
     TGraph graph = popolateGraph(argv[1]);
 
-    int sccsCount;
-    TArray* sccs;
+    TSCCs sccs;
 
     clock_t begin = clock();
 
     #ifdef TARJAN
-        sccs = scc(graph, 0, graph->vertices, &sccsCount); 
+        sccs = scc(graph, 0, graph->vertices); 
     #endif
 
     #ifdef KOSARAJU
-        sccs = kosaraju(graph, 0, graph->vertices, &sccsCount);
+        sccs = kosaraju(graph, 0, graph->vertices);
+    #endif
+
+    #ifdef PEARCE
+        sccs = pearce(graph, 0, graph->vertices);
+    #endif
+
+    #ifdef FWBW
+        sccs = fwbw(graph, 0, graph->vertices);
+    #endif
+
+    #ifdef COLORING
+        sccs = coloring(graph, 0, graph->vertices);
+    #endif
+
+    #ifdef MULTISTEP
+        sccs = multistep(graph, 0, graph->vertices);
     #endif 
 
     clock_t end = clock();
     double elapsed = (double)(end - begin) / CLOCKS_PER_SEC;
 
-    #ifndef TEST
+    #if !defined(TEST) && !defined(MULTISTEP)
         printf("0,%f,0,%f\n", elapsed, elapsed);          
     #endif
+
+    #if !defined(TEST) && defined(MULTISTEP)
+        printf("0,%f,0,%f,%f,%f,%f,%f\n", elapsed, elapsed, 
+            multistepTimes.trim, multistepTimes.fwbw, multistepTimes.coloring, multistepTimes.tarjan);
+    #endif
     
     #ifdef TEST
-        printSCCsOnFile(sccsCount, sccs, graph->vertices, NULL, "../test/SCCSeqOut.txt");
+        printSCCsOnFile(&sccs, graph->vertices, NULL, "../test/SCCSeqOut.txt");
     #endif
 
-    for(int i = 0; i < sccsCount; i++) 
-        arrayDestroy(&sccs[i]);
-    free(sccs);
+    if(argc == 3) {
+        int vertices = graph->vertices > 0 ? graph->ids[graph->vertices - 1] + 1 : 0;
+        int *label = (int *) malloc((vertices + 1) * sizeof(int));
+        sccsLabel(&sccs, vertices, NULL, label);
+        sccsSaveLabels(label, vertices, sccs.count, argv[2]);
+        free(label);
+    }
+
+    sccsDestroy(&sccs);
     graphDestroy(graph);
 
     return 0;
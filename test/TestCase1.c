@@ -68,7 +68,24 @@
  * the code calls the destroyResults() function which takes the res variable as an argument, this function frees 
  * the memory allocated for the res variable. The code then removes the output files of the sequential and parallel 
  * versions of the Tarjan algorithm using the remove function. Then the code repeats the same process but this time 
- * for the Kosaraju algorithm. Finally, the code removes the input graph file.
+ * for the Kosaraju, Pearce, FW-BW, Coloring and Multistep algorithms. Then the code converts the graph to the 
+ * binary format and compares the sequential Tarjan on the text file with the parallel Tarjan on the binary file. 
+ * Then it computes the permutation file of the binary graph and compares the sequential Tarjan with the parallel 
+ * Tarjan on 4 processes, which split the graph following the permutation. 
+ * Then it compares the sequential version of every algorithm with its ParallelMsgTest build on 5 processes, and 
+ * the sequential Tarjan with the ParallelMsgTest Tarjan on 7 processes on the binary file and its permutation: 
+ * these builds exchange the merge payloads as messages of a few integers, compressed above 4 integers, with a 
+ * fan-in of 3, so every transfer of the merge rounds goes through the chunked streams and the compression. 
+ * Then every algorithm is run again, sequential and parallel on 3 processes, with a third argument, the labels 
+ * file, and so is the ParallelMsgTest Tarjan on 4 processes on the binary file: readLabels() reads both SCCLABEL 
+ * files, checkLabels() checks that each of them labels every vertex, with no -1, and agrees with the SCCs of 
+ * its output file, and compareLabels() checks that the two files define the same partition of the vertices. 
+ * Then it compares the sequential Multistep with the parallel Multistep on 5 processes with 1 OpenMP thread on 
+ * the fixed graph of graphMultistep.txt: its cuts are small enough for Multistep to skip the FW-BW and 
+ * coloring phases and go straight from the trimming to the Tarjan phase, in the first pass and in every merge 
+ * round. The comparison is repeated MULTISTEP_RUNS_TEST times, since the order in which the merge messages 
+ * arrive, and so the condensed graphs of the rounds, changes from run to run. 
+ * Finally, the code removes the generated graph files.
 */
 
 #include "../include/TestUtil.h"
@@ -76,6 +93,10 @@
 #define VERTICES_TEST 100
 #define LB_TEST 0
 #define HB_TEST 10
+#define MULTISTEP_RUNS_TEST 8
+#define ENGINES_TEST 6
+
+static const char* engines[ENGINES_TEST] = {"tarjan", "kosaraju", "pearce", "fwbw", "coloring", "multistep"};
 
 int main(int argc, char **argv) {
 
@@ -110,10 +131,205 @@ int main(int argc, char **argv) {
 
     destroyResults(res);
 
-    remove(FILE_IN_GRAPH);
     remove(FILE_OUT_SEQ);
     remove(FILE_OUT_PAR);
 
+    res = (Results*)malloc(sizeof(Results));
+
+    system("../build/pearceSequentialTest ../test/graphTest.txt");
+    system("mpirun -np 2 ../build/pearceParallelTest 2 ../test/graphTest.txt");
+
+    res->sequentialResult = readResult(FILE_OUT_SEQ, &res->sequentialSCCsNum);
+    res->parallelResult = readResult(FILE_OUT_PAR, &res->parallelSCCsNum);
+    
+    compareResults(res);
+
+    destroyResults(res);
+
+    remove(FILE_OUT_SEQ);
+    remove(FILE_OUT_PAR);
+
+    res = (Results*)malloc(sizeof(Results));
+
+    system("../build/fwbwSequentialTest ../test/graphTest.txt");
+    system("mpirun -np 2 ../build/fwbwParallelTest 2 ../test/graphTest.txt");
+
+    res->sequentialResult = readResult(FILE_OUT_SEQ, &res->sequentialSCCsNum);
+    res->parallelResult = readResult(FILE_OUT_PAR, &res->parallelSCCsNum);
+    
+    compareResults(res);
+
+    destroyResults(res);
+
+    remove(FILE_OUT_SEQ);
+    remove(FILE_OUT_PAR);
+
+    res = (Results*)malloc(sizeof(Results));
+
+    system("../build/coloringSequentialTest ../test/graphTest.txt");
+    system("mpirun -np 2 ../build/coloringParallelTest 2 ../test/graphTest.txt");
+
+    res->sequentialResult = readResult(FILE_OUT_SEQ, &res->sequentialSCCsNum);
+    res->parallelResult = readResult(FILE_OUT_PAR, &res->parallelSCCsNum);
+    
+    compareResults(res);
+
+    destroyResults(res);
+
+    remove(FILE_OUT_SEQ);
+    remove(FILE_OUT_PAR);
+
+    res = (Results*)malloc(sizeof(Results));
+
+    system("../build/multistepSequentialTest ../test/graphTest.txt");
+    system("mpirun -np 2 ../build/multistepParallelTest 2 ../test/graphTest.txt");
+
+    res->sequentialResult = readResult(FILE_OUT_SEQ, &res->sequentialSCCsNum);
+    res->parallelResult = readResult(FILE_OUT_PAR, &res->parallelSCCsNum);
+    
+    compareResults(res);
+
+    destroyResults(res);
+
+    remove(FILE_OUT_SEQ);
+    remove(FILE_OUT_PAR);
+
+    res = (Results*)malloc(sizeof(Results));
+
+    system("../build/convertGraph ../test/graphTest.txt ../test/graphTest.bin");
+    system("../build/tarjanSequentialTest ../test/graphTest.txt");
+    system("mpirun -np 2 ../build/tarjanParallelTest 2 ../test/graphTest.bin");
+
+    res->sequentialResult = readResult(FILE_OUT_SEQ, &res->sequentialSCCsNum);
+    res->parallelResult = readResult(FILE_OUT_PAR, &res->parallelSCCsNum);
+    
+    compareResults(res);
+
+    destroyResults(res);
+
+    remove(FILE_OUT_SEQ);
+    remove(FILE_OUT_PAR);
+
+    res = (Results*)malloc(sizeof(Results));
+
+    system("../build/partitionGraph ../test/graphTest.bin 4");
+    system("../build/tarjanSequentialTest ../test/graphTest.txt");
+    system("mpirun -np 4 ../build/tarjanParallelTest 2 ../test/graphTest.bin");
+
+    res->sequentialResult = readResult(FILE_OUT_SEQ, &res->sequentialSCCsNum);
+    res->parallelResult = readResult(FILE_OUT_PAR, &res->parallelSCCsNum);
+    
+    compareResults(res);
+
+    destroyResults(res);
+
+    remove(FILE_OUT_SEQ);
+    remove(FILE_OUT_PAR);
+
+    for(int i = 0; i < ENGINES_TEST; i++) {
+
+        char command[256];
+
+        res = (Results*)malloc(sizeof(Results));
+
+        snprintf(command, sizeof(command), "../build/%sSequentialTest ../test/graphTest.txt", engines[i]);
+        system(command);
+        snprintf(command, sizeof(command), "mpirun -np 5 ../build/%sParallelMsgTest 2 ../test/graphTest.txt", engines[i]);
+        system(command);
+
+        res->sequentialResult = readResult(FILE_OUT_SEQ, &res->sequentialSCCsNum);
+        res->parallelResult = readResult(FILE_OUT_PAR, &res->parallelSCCsNum);
+        
+        compareResults(res);
+
+        destroyResults(res);
+
+        remove(FILE_OUT_SEQ);
+        remove(FILE_OUT_PAR);
+    }
+
+    res = (Results*)malloc(sizeof(Results));
+
+    system("../build/tarjanSequentialTest ../test/graphTest.txt");
+    system("mpirun -np 7 ../build/tarjanParallelMsgTest 2 ../test/graphTest.bin");
+
+    res->sequentialResult = readResult(FILE_OUT_SEQ, &res->sequentialSCCsNum);
+    res->parallelResult = readResult(FILE_OUT_PAR, &res->parallelSCCsNum);
+    
+    compareResults(res);
+
+    destroyResults(res);
+
+    remove(FILE_OUT_SEQ);
+    remove(FILE_OUT_PAR);
+
+    for(int i = 0; i <= ENGINES_TEST; i++) {
+
+        char command[256];
+        int sequentialVertices,
+            parallelVertices,
+            sequentialComponents,
+            parallelComponents;
+
+        res = (Results*)malloc(sizeof(Results));
+
+        if(i < ENGINES_TEST) {
+            snprintf(command, sizeof(command), "../build/%sSequentialTest ../test/graphTest.txt %s", engines[i], FILE_OUT_LABELS_SEQ);
+            system(command);
+            snprintf(command, sizeof(command), "mpirun -np 3 ../build/%sParallelTest 2 ../test/graphTest.txt %s", engines[i], FILE_OUT_LABELS_PAR);
+            system(command);
+        } else {
+            system("../build/tarjanSequentialTest ../test/graphTest.txt " FILE_OUT_LABELS_SEQ);
+            system("mpirun -np 4 ../build/tarjanParallelMsgTest 2 ../test/graphTest.bin " FILE_OUT_LABELS_PAR);
+        }
+
+        res->sequentialResult = readResult(FILE_OUT_SEQ, &res->sequentialSCCsNum);
+        res->parallelResult = readResult(FILE_OUT_PAR, &res->parallelSCCsNum);
+
+        compareResults(res);
+
+        int* sequentialLabels = readLabels(FILE_OUT_LABELS_SEQ, &sequentialVertices, &sequentialComponents);
+        int* parallelLabels = readLabels(FILE_OUT_LABELS_PAR, &parallelVertices, &parallelComponents);
+
+        assert(sequentialVertices == VERTICES_TEST && parallelVertices == VERTICES_TEST);
+
+        checkLabels(sequentialLabels, sequentialVertices, sequentialComponents, res->sequentialResult, res->sequentialSCCsNum);
+        checkLabels(parallelLabels, parallelVertices, parallelComponents, res->parallelResult, res->parallelSCCsNum);
+        compareLabels(sequentialLabels, parallelLabels, sequentialVertices, sequentialComponents);
+
+        free(sequentialLabels);
+        free(parallelLabels);
+
+        destroyResults(res);
+
+        remove(FILE_OUT_SEQ);
+        remove(FILE_OUT_PAR);
+        remove(FILE_OUT_LABELS_SEQ);
+        remove(FILE_OUT_LABELS_PAR);
+    }
+
+    for(int run = 0; run < MULTISTEP_RUNS_TEST; run++) {
+
+        res = (Results*)malloc(sizeof(Results));
+
+        system("../build/multistepSequentialTest ../test/graphMultistep.txt");
+        system("mpirun -np 5 ../build/multistepParallelTest 1 ../test/graphMultistep.txt");
+
+        res->sequentialResult = readResult(FILE_OUT_SEQ, &res->sequentialSCCsNum);
+        res->parallelResult = readResult(FILE_OUT_PAR, &res->parallelSCCsNum);
+        
+        compareResults(res);
+
+        destroyResults(res);
+
+        remove(FILE_OUT_SEQ);
+        remove(FILE_OUT_PAR);
+    }
+
+    remove(FILE_IN_GRAPH);
+    remove(FILE_IN_GRAPH_BINARY);
+    remove(FILE_IN_GRAPH_PERMUTATION);
+
     /*-------------------------------------------------------------------------------------*/
 
 }
\ No newline at end of file
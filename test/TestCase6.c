@@ -68,7 +68,7 @@
  * the code calls the destroyResults() function which takes the res variable as an argument, this function frees 
  * the memory allocated for the res variable. The code then removes the output files of the sequential and parallel 
  * versions of the Tarjan algorithm using the remove function. Then the code repeats the same process but this time 
- * for the Kosaraju algorithm. Finally, the code removes the input graph file.
+ * for the Kosaraju, Pearce, FW-BW, Coloring and Multistep algorithms. Finally, the code removes the input graph file.
 */
 
 #include "../include/TestUtil.h"
@@ -110,6 +110,66 @@ int main(int argc, char **argv) {
 
     destroyResults(res);
 
+    remove(FILE_OUT_SEQ);
+    remove(FILE_OUT_PAR);
+
+    res = (Results*)malloc(sizeof(Results));
+
+    system("../build/pearceSequentialTest ../test/graphTest.txt");
+    system("mpirun -np 2 ../build/pearceParallelTest 2 ../test/graphTest.txt");
+    
+    res->sequentialResult = readResult(FILE_OUT_SEQ, &res->sequentialSCCsNum);
+    res->parallelResult = readResult(FILE_OUT_PAR, &res->parallelSCCsNum);
+    
+    compareResults(res);
+
+    destroyResults(res);
+
+    remove(FILE_OUT_SEQ);
+    remove(FILE_OUT_PAR);
+
+    res = (Results*)malloc(sizeof(Results));
+
+    system("../build/fwbwSequentialTest ../test/graphTest.txt");
+    system("mpirun -np 2 ../build/fwbwParallelTest 2 ../test/graphTest.txt");
+    
+    res->sequentialResult = readResult(FILE_OUT_SEQ, &res->sequentialSCCsNum);
+    res->parallelResult = readResult(FILE_OUT_PAR, &res->parallelSCCsNum);
+    
+    compareResults(res);
+
+    destroyResults(res);
+
+    remove(FILE_OUT_SEQ);
+    remove(FILE_OUT_PAR);
+
+    res = (Results*)malloc(sizeof(Results));
+
+    system("../build/coloringSequentialTest ../test/graphTest.txt");
+    system("mpirun -np 2 ../build/coloringParallelTest 2 ../test/graphTest.txt");
+    
+    res->sequentialResult = readResult(FILE_OUT_SEQ, &res->sequentialSCCsNum);
+    res->parallelResult = readResult(FILE_OUT_PAR, &res->parallelSCCsNum);
+    
+    compareResults(res);
+
+    destroyResults(res);
+
+    remove(FILE_OUT_SEQ);
+    remove(FILE_OUT_PAR);
+
+    res = (Results*)malloc(sizeof(Results));
+
+    system("../build/multistepSequentialTest ../test/graphTest.txt");
+    system("mpirun -np 2 ../build/multistepParallelTest 2 ../test/graphTest.txt");
+    
+    res->sequentialResult = readResult(FILE_OUT_SEQ, &res->sequentialSCCsNum);
+    res->parallelResult = readResult(FILE_OUT_PAR, &res->parallelSCCsNum);
+    
+    compareResults(res);
+
+    destroyResults(res);
+
     remove(FILE_IN_GRAPH);
     remove(FILE_OUT_SEQ);
     remove(FILE_OUT_PAR);
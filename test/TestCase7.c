@@ -0,0 +1,312 @@
+/* 
+ * Course: High Performance Computing 2022/2023
+ * 
+ * Lecturer: Francesco Moscato	fmoscato@unisa.it
+ *
+ * Group:
+ * Amato Emilio        0622701903      e.amato16@studenti.unisa.it             
+ * Bove Antonio        0622701898      a.bove57@studenti.unisa.it 
+ * De Gregorio Marco   0622701865      m.degregorio19@studenti.unisa.it
+ * 
+ * Source Code for sequential version:
+ * https://www.geeksforgeeks.org/tarjan-algorithm-find-strongly-connected-components/
+ *
+ * Copyright (C) 2023 - All Rights Reserved
+ *
+ * This file is part of FinalProjectHPC.
+ *
+ * This program is free software: you can redistribute it and/or modify it under the terms of 
+ * the GNU General Public License as published by the Free Software Foundation, either version 
+ * 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; 
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with ContestOMP. 
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *                                  REQUIREMENTS OF THE ASSIGNMENT 
+ * 
+ * Provide a parallel version of the Tarjan's algorithm to find Strongly Connected Components in 
+ * a Graph. The implementation MUST use an hybrid message passing / shared memory paradigm. and 
+ * has to be implemented by using MPI and openMP. Students MUST provide parallel processes on 
+ * different nodes, and each process has to be parallelized by using Open MP (i.e.: MPI will spawn 
+ * OPENMP-compiled processes). Students can choose the graph allocation method the prefer. They can 
+ * eventually produce the graph directly in distributed memory (without store anything). Good Graph 
+ * dimensions are greater than 4GB of data.
+ * 
+ * @file TestCase7.c
+ * 
+ * @brief This code is a test driver for the open addressing hash table THashTable, comparing every search 
+ * with a reference array while keys are inserted, replaced, deleted and inserted again.
+ * 
+ * @version 0.1
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+
+/**
+ * This code is a test case for the hash table shared by THTSCCs, THTAuxiliaryGraph and THTAuxiliarySCC. The keys 
+ * are taken from a universe of KEYS_TEST clustered keys, consecutive like the identifiers given by calculateId, 
+ * and KEYS_TEST scattered keys, spread over the negative integers by a multiplicative hash. The reference array 
+ * stores the value expected for every key of the universe, or -1 if the key must not be in the table, and 
+ * checkTable() searches every key of the universe with hashTableSearch() and compares the result with the 
+ * reference; it also checks that count and deleted match the control bytes and that the last HASH_TABLE_GROUP 
+ * control bytes mirror the first ones. The first step creates a table of the minimum capacity and inserts all the 
+ * keys, alternating the clustered and the scattered ones, so that the table is grown several times. Then the 
+ * values of half of the keys are replaced, which must not change the number of keys, and a third of the keys are 
+ * deleted, which leaves tombstones without growing the table. The table is then rehashed, which must drop all the 
+ * tombstones. Since after the rehash every slot before a key in its probe sequence is full, a key deleted and 
+ * inserted again must take back its own tombstone, which is checked for another third of the keys before the 
+ * deleted ones are inserted again. The next step keeps only a window of KEYS_TEST / 2 keys and slides it over the 
+ * universe, deleting its first key and inserting the one after its end, so that the tombstones pile up until an 
+ * insert rehashes the table, which must leave none of them. After that 
+ * hashTableReserve() is called for the keys still to be inserted, and their inserts must not grow the table 
+ * again, while reserving less room than the table already has must leave it untouched. Finally a table of 
+ * HASH_TABLE_GROUP slots, where every group wraps around the end of the control array, is filled up to its 
+ * maximum load, half emptied and filled again, checking it after every operation.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "../include/THashTable.h"
+
+#define KEYS_TEST 3000
+#define SCATTER_TEST 2654435761u
+
+/**
+ * This function checks a table against the reference array: every key of the universe is searched, and the value 
+ * found must match the reference, or the key must be missing if its reference is -1. Then the control bytes are 
+ * scanned, to check that count and deleted match the slots holding a key and the tombstones, and that the control 
+ * bytes after the end of the table mirror the first HASH_TABLE_GROUP ones.
+ * 
+ * @param table A pointer to the table
+ * @param universe The keys that can be in the table
+ * @param reference The value of every key of the universe, or -1 if the key is not in the table
+ * @param n The number of keys of the universe
+*/
+static void checkTable(THashTable* table, const int* universe, const int* reference, int n) {
+
+    int count = 0,
+        deleted = 0;
+
+    for(int i = 0; i < n; i++) {
+        int* value = (int*)hashTableSearch(table, universe[i]);
+        if(reference[i] < 0)
+            assert(value == NULL);
+        else
+            assert(value != NULL && *value == reference[i]);
+        if(reference[i] >= 0)
+            count++;
+    }
+    assert(table->count == count);
+
+    count = 0;
+    for(int slot = 0; slot < table->capacity; slot++) {
+        if(HASH_TABLE_FULL(table, slot))
+            count++;
+        else if(table->control[slot] == HASH_TABLE_DELETED)
+            deleted++;
+        else
+            assert(table->control[slot] == HASH_TABLE_EMPTY);
+    }
+    assert(table->count == count);
+    assert(table->deleted == deleted);
+
+    for(int slot = 0; slot < HASH_TABLE_GROUP; slot++)
+        assert(table->control[table->capacity + slot] == table->control[slot]);
+}
+
+/**
+ * This function inserts a key of the universe in the table and records its value in the reference array.
+ * 
+ * @param table A pointer to the table
+ * @param universe The keys that can be in the table
+ * @param reference The value of every key of the universe
+ * @param i The index of the key in the universe
+ * @param value The value of the key
+*/
+static void insertKey(THashTable* table, const int* universe, int* reference, int i, int value) {
+
+    hashTableInsert(table, universe[i], &value);
+    reference[i] = value;
+}
+
+/**
+ * This function deletes a key of the universe from the table and marks it as missing in the reference array.
+ * 
+ * @param table A pointer to the table
+ * @param universe The keys that can be in the table
+ * @param reference The value of every key of the universe
+ * @param i The index of the key in the universe
+*/
+static void deleteKey(THashTable* table, const int* universe, int* reference, int i) {
+
+    hashTableDelete(table, universe[i]);
+    reference[i] = -1;
+}
+
+int main(int argc, char **argv) {
+
+    /*------------------------------------ CASE TEST 7 ------------------------------------*/
+
+    int n = 2 * KEYS_TEST;
+    int* universe = (int*)malloc(n * sizeof(int));
+    int* reference = (int*)malloc(n * sizeof(int));
+
+    for(int i = 0; i < KEYS_TEST; i++) {
+        universe[2 * i] = 1000 + i;
+        universe[2 * i + 1] = -1 - (int)(((unsigned)i * SCATTER_TEST) & 0x7FFFFFFF);
+    }
+    for(int i = 0; i < n; i++)
+        reference[i] = -1;
+
+    THashTable table = hashTableCreate(0, sizeof(int));
+    assert(table.capacity == HASH_TABLE_GROUP);
+
+    int capacity = table.capacity,
+        resizes = 0;
+
+    for(int i = 0; i < n; i++) {
+        insertKey(&table, universe, reference, i, i);
+        if(table.capacity != capacity) {
+            capacity = table.capacity;
+            resizes++;
+            checkTable(&table, universe, reference, n);
+        }
+    }
+    assert(resizes >= 5);
+    checkTable(&table, universe, reference, n);
+
+    /*------------------------------------ REPLACE ------------------------------------*/
+
+    int count = table.count;
+    for(int i = 0; i < n; i += 2)
+        insertKey(&table, universe, reference, i, n + i);
+    assert(table.count == count && table.capacity == capacity);
+    checkTable(&table, universe, reference, n);
+
+    /*------------------------------------ DELETE ------------------------------------*/
+
+    for(int i = 0; i < n; i += 3)
+        deleteKey(&table, universe, reference, i);
+    assert(table.capacity == capacity && table.deleted > 0);
+    checkTable(&table, universe, reference, n);
+
+    hashTableDelete(&table, universe[0]);
+    checkTable(&table, universe, reference, n);
+
+    /*------------------------------------ RESIZE ------------------------------------*/
+
+    count = table.count;
+    hashTableResize(&table, 0);
+    assert(table.count == count && table.deleted == 0 && table.capacity <= capacity);
+    capacity = table.capacity;
+    checkTable(&table, universe, reference, n);
+
+    /*------------------------------------ TOMBSTONE REUSE ------------------------------------*/
+
+    for(int i = 1; i < n; i += 3) {
+        if(reference[i] < 0)
+            continue;
+        int* slot = (int*)hashTableSearch(&table, universe[i]);
+        deleteKey(&table, universe, reference, i);
+        assert(table.deleted == 1);
+        insertKey(&table, universe, reference, i, i);
+        assert(table.capacity == capacity && table.deleted == 0);
+        assert((int*)hashTableSearch(&table, universe[i]) == slot);
+    }
+    checkTable(&table, universe, reference, n);
+
+    for(int i = 0; i < n; i += 3)
+        insertKey(&table, universe, reference, i, 2 * n + i);
+    checkTable(&table, universe, reference, n);
+
+    /*------------------------------------ CHURN ------------------------------------*/
+
+    int window = KEYS_TEST / 2;
+    for(int i = window; i < n; i++)
+        deleteKey(&table, universe, reference, i);
+    hashTableResize(&table, 0);
+    checkTable(&table, universe, reference, n);
+
+    int8_t* control = table.control;
+    resizes = 0;
+
+    for(int i = 0; i + window < n; i++) {
+        deleteKey(&table, universe, reference, i);
+        insertKey(&table, universe, reference, i + window, 3 * n + i);
+        if(table.control != control) {
+            assert(table.deleted == 0);
+            control = table.control;
+            resizes++;
+            checkTable(&table, universe, reference, n);
+        }
+    }
+    assert(resizes > 0);
+    checkTable(&table, universe, reference, n);
+
+    /*------------------------------------ RESERVE ------------------------------------*/
+
+    int missing = 0;
+    for(int i = 0; i < n; i++)
+        if(reference[i] < 0)
+            missing++;
+
+    hashTableReserve(&table, table.count + missing);
+    capacity = table.capacity;
+    assert((long long)(table.count + missing + table.deleted) * 8 <= (long long)capacity * HASH_TABLE_MAX_LOAD);
+
+    for(int i = 0; i < n; i++)
+        if(reference[i] < 0)
+            insertKey(&table, universe, reference, i, 4 * n + i);
+    assert(table.capacity == capacity);
+    checkTable(&table, universe, reference, n);
+
+    control = table.control;
+    hashTableReserve(&table, 1);
+    assert(table.control == control && table.capacity == capacity);
+
+    hashTableDestroy(&table);
+
+    /*------------------------------------ WRAP AROUND ------------------------------------*/
+
+    for(int i = 0; i < n; i++)
+        reference[i] = -1;
+
+    table = hashTableCreate(1, sizeof(int));
+    int limit = HASH_TABLE_GROUP * HASH_TABLE_MAX_LOAD / 8;
+
+    for(int i = 0; i < limit; i++) {
+        insertKey(&table, universe, reference, i, i);
+        assert(table.capacity == HASH_TABLE_GROUP);
+        checkTable(&table, universe, reference, n);
+    }
+    for(int i = 0; i < limit; i += 2) {
+        deleteKey(&table, universe, reference, i);
+        checkTable(&table, universe, reference, n);
+    }
+    for(int i = 0; i < limit; i += 2) {
+        insertKey(&table, universe, reference, i, n + i);
+        checkTable(&table, universe, reference, n);
+    }
+    for(int i = 0; i < limit; i++) {
+        deleteKey(&table, universe, reference, i);
+        checkTable(&table, universe, reference, n);
+    }
+    assert(table.count == 0);
+
+    hashTableDestroy(&table);
+
+    free(universe);
+    free(reference);
+
+    return 0;
+}